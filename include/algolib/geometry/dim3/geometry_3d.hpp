@@ -37,6 +37,15 @@ namespace algolib::geometry::dim3
      */
     double distance(const point_3d & point1, const point_3d & point2);
 
+    /*!
+     * \brief Calculates Manhattan distance between given points, which is the sum of absolute
+     * differences of their coordinates.
+     * \param point1 the first point
+     * \param point2 the second point
+     * \return the Manhattan distance between the points
+     */
+    double manhattan_distance(const point_3d & point1, const point_3d & point2);
+
     /*!
      * \brief Translates given point by given vector.
      * \param point the point
@@ -9,9 +9,9 @@
 #include <algorithm>
 #include <limits>
 #include <numeric>
-#include <unordered_map>
 #include <vector>
 #include "algolib/graphs/algorithms/searching.hpp"
+#include "algolib/graphs/flat_hash.hpp"
 #include "algolib/graphs/undirected_graph.hpp"
 
 namespace internal
@@ -19,19 +19,13 @@ namespace internal
     namespace algr = algolib::graphs;
 
     template <typename Vertex>
-    struct cutting_strategy : public algr::dfs_strategy<Vertex>
+    struct cutting_strategy : public algr::static_strategy<Vertex>
     {
         cutting_strategy() : depth{0}
         {
         }
 
-        ~cutting_strategy() override = default;
-
-        void for_root(const Vertex &) override
-        {
-        }
-
-        void on_entry(const Vertex & vertex) override
+        void on_entry(const Vertex & vertex)
         {
             this->dfs_depths.emplace(vertex, depth);
             this->low_values.emplace(vertex, depth);
@@ -39,13 +33,13 @@ namespace internal
             ++depth;
         }
 
-        void on_next_vertex(const Vertex & vertex, const Vertex & neighbour) override
+        void on_next_vertex(const Vertex & vertex, const Vertex & neighbour)
         {
             this->dfs_parents.emplace(neighbour, vertex);
             this->dfs_children[vertex].push_back(neighbour);
         }
 
-        void on_exit(const Vertex & vertex) override
+        void on_exit(const Vertex & vertex)
         {
             int minimal_low_value = std::accumulate(this->dfs_children[vertex].begin(),
                     this->dfs_children[vertex].end(), std::numeric_limits<int>::max(),
@@ -56,7 +50,7 @@ namespace internal
             --depth;
         }
 
-        void on_edge_to_visited(const Vertex & vertex, const Vertex & neighbour) override
+        void on_edge_to_visited(const Vertex & vertex, const Vertex & neighbour)
         {
             if(neighbour != this->dfs_parents.at(vertex))
                 this->low_values[vertex] =
@@ -84,10 +78,10 @@ namespace internal
             return this->dfs_depths[vertex] == 0;
         }
 
-        std::unordered_map<Vertex, Vertex> dfs_parents;
-        std::unordered_map<Vertex, std::vector<Vertex>> dfs_children;
-        std::unordered_map<Vertex, int> dfs_depths;
-        std::unordered_map<Vertex, int> low_values;
+        flat_hash_map<Vertex, Vertex> dfs_parents;
+        flat_hash_map<Vertex, std::vector<Vertex>> dfs_children;
+        flat_hash_map<Vertex, int> dfs_depths;
+        flat_hash_map<Vertex, int> low_values;
         int depth;
     };
 }
@@ -5,18 +5,14 @@
 #ifndef LOWEST_COMMON_ANCESTOR_HPP_
 #define LOWEST_COMMON_ANCESTOR_HPP_
 
-#include <cmath>
 #include <cstdlib>
 #include <algorithm>
-#include <unordered_map>
+#include <memory>
 #include <vector>
-#include "algolib/graphs/algorithms/searching.hpp"
 #include "algolib/graphs/tree_graph.hpp"
 
 namespace algolib::graphs
 {
-#pragma region lowest_common_ancestor
-
     template <
             typename VertexId = size_t,
             typename VertexProperty = std::nullptr_t,
@@ -28,12 +24,8 @@ namespace algolib::graphs
         using tree_type = tree_graph<VertexId, VertexProperty, EdgeProperty>;
         using vertex_type = typename tree_type::vertex_type;
 
-    private:
-        struct lca_strategy;
-
-    public:
         lowest_common_ancestor(const tree_type & graph, const vertex_type & root)
-            : graph{graph}, empty{true}, root_{root}
+            : graph{graph}, root_{root}
         {
         }
 
@@ -50,115 +42,77 @@ namespace algolib::graphs
          */
         vertex_type find_lca(const vertex_type & vertex1, const vertex_type & vertex2)
         {
-            if(this->empty)
-                this->initialize();
-
-            return this->find(vertex1, vertex2);
+            // the view is kept, so that views for other roots do not evict it from the tree, and
+            // jumps are rebuilt only when the tree has changed since the last query
+            if(this->tree == nullptr || this->tree_version != this->graph.version())
+            {
+                this->tree_version = this->graph.version();
+                this->initialize(this->graph.rooted(this->root_));
+            }
+
+            return this->find(this->tree->index(vertex1), this->tree->index(vertex2));
         }
 
         const tree_type & graph;
 
     private:
-        void initialize();
-        vertex_type find(const vertex_type & vertex1, const vertex_type & vertex2);
-        bool is_offspring(const vertex_type & vertex1, const vertex_type & vertex2);
+        void initialize(const std::shared_ptr<const rooted_tree<VertexId>> & rooted);
+        vertex_type find(size_t index1, size_t index2) const;
 
-        bool empty;
         vertex_type root_;
-        std::unordered_map<vertex_type, std::vector<vertex_type>> paths;
-        lca_strategy strategy;
+        std::shared_ptr<const rooted_tree<VertexId>> tree;
+        size_t tree_version = 0;
+        // ancestors of vertices 2^i levels up, level after level
+        std::vector<size_t> jumps;
+        size_t levels = 0;
     };
 
     template <typename VertexId, typename VertexProperty, typename EdgeProperty>
-    typename lowest_common_ancestor<VertexId, VertexProperty, EdgeProperty>::vertex_type
-            lowest_common_ancestor<VertexId, VertexProperty, EdgeProperty>::find(
-                    const vertex_type & vertex1,
-                    const vertex_type & vertex2)
+    void lowest_common_ancestor<VertexId, VertexProperty, EdgeProperty>::initialize(
+            const std::shared_ptr<const rooted_tree<VertexId>> & rooted)
     {
-        if(this->is_offspring(vertex1, vertex2))
-            return vertex2;
-
-        if(this->is_offspring(vertex2, vertex1))
-            return vertex1;
-
-        std::vector<vertex_type> candidates = paths[vertex1];
+        size_t size = rooted->size();
 
-        auto it = std::find_if(
-                candidates.rbegin(), candidates.rend(),
-                [&](auto && candidate) { return !this->is_offspring(vertex2, candidate); });
+        this->tree = rooted;
+        this->levels = 1;
 
-        return it != candidates.rend() ? find(*it, vertex2) : find(paths[vertex1][0], vertex2);
-    }
-
-    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
-    void lowest_common_ancestor<VertexId, VertexProperty, EdgeProperty>::initialize()
-    {
-        dfs_recursive(this->graph, this->strategy, {this->root_});
-
-        for(auto && vertex : this->graph.vertices())
-            this->paths.emplace(
-                    vertex, std::vector<vertex_type>({this->strategy.parents.at(vertex)}));
+        while((size_t(1) << this->levels) < size)
+            ++this->levels;
 
-        for(int i = 0; i < std::log2(this->graph.vertices_count()) + 3; ++i)
-            for(auto && vertex : this->graph.vertices())
-                this->paths[vertex].push_back(this->paths[this->paths[vertex][i]][i]);
+        this->jumps.resize(this->levels * size);
+        std::copy(rooted->parents().begin(), rooted->parents().end(), this->jumps.begin());
 
-        this->empty = false;
+        for(size_t level = 1; level < this->levels; ++level)
+            for(size_t i = 0; i < size; ++i)
+                this->jumps[level * size + i] =
+                        this->jumps[(level - 1) * size + this->jumps[(level - 1) * size + i]];
     }
 
     template <typename VertexId, typename VertexProperty, typename EdgeProperty>
-    bool lowest_common_ancestor<VertexId, VertexProperty, EdgeProperty>::is_offspring(
-            const vertex_type & vertex1,
-            const vertex_type & vertex2)
-    {
-        return this->strategy.pre_times[vertex1] >= this->strategy.pre_times[vertex2]
-               && this->strategy.post_times[vertex1] <= this->strategy.post_times[vertex2];
-    }
-
-#pragma endregion
-#pragma region lca_strategy
-
-    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
-    struct lowest_common_ancestor<VertexId, VertexProperty, EdgeProperty>::lca_strategy
-        : public dfs_strategy<vertex_type>
+    typename lowest_common_ancestor<VertexId, VertexProperty, EdgeProperty>::vertex_type
+            lowest_common_ancestor<VertexId, VertexProperty, EdgeProperty>::find(
+                    size_t index1,
+                    size_t index2) const
     {
-        lca_strategy() : timer{0}
-        {
-        }
+        size_t size = this->tree->size();
 
-        void for_root(const vertex_type & root) override
-        {
-            this->parents.emplace(root, root);
-        }
+        if(this->tree->is_ancestor(index2, index1))
+            return this->tree->vertices()[index2];
 
-        void on_entry(const vertex_type & vertex) override
-        {
-            this->pre_times.emplace(vertex, this->timer);
-            ++this->timer;
-        }
+        if(this->tree->is_ancestor(index1, index2))
+            return this->tree->vertices()[index1];
 
-        void on_next_vertex(const vertex_type & vertex, const vertex_type & neighbour) override
+        // climbs from the first vertex to the highest ancestor that is still not common
+        for(size_t level = this->levels; level-- > 0;)
         {
-            this->parents.emplace(neighbour, vertex);
-        }
-
-        void on_exit(const vertex_type & vertex) override
-        {
-            this->post_times.emplace(vertex, this->timer);
-            ++this->timer;
-        }
+            size_t ancestor = this->jumps[level * size + index1];
 
-        void on_edge_to_visited(const vertex_type &, const vertex_type &) override
-        {
+            if(!this->tree->is_ancestor(ancestor, index2))
+                index1 = ancestor;
         }
 
-        std::unordered_map<vertex_type, vertex_type> parents;
-        std::unordered_map<vertex_type, int> pre_times;
-        std::unordered_map<vertex_type, int> post_times;
-        int timer;
-    };
-
-#pragma endregion
+        return this->tree->vertices()[this->tree->parents()[index1]];
+    }
 }
 
 #endif
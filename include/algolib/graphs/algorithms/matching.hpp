@@ -6,6 +6,7 @@
 #define MATCHING_HPP_
 
 #include <limits>
+#include <memory_resource>
 #include <numeric>
 #include <optional>
 #include <queue>
@@ -72,7 +73,8 @@ namespace internal
     > match_augmenter<VertexId, VertexProperty, EdgeProperty>::unmatched_vertices()
     {
         std::vector<typename graph_t::vertex_type> unmatched;
-        std::vector<typename graph_t::vertex_type> group = this->graph.vertices_from_group(1);
+        const std::pmr::vector<typename graph_t::vertex_type> & group =
+                this->graph.vertices_from_group(1);
 
         std::copy_if(group.begin(), group.end(), std::back_inserter(unmatched),
                 [&](typename graph_t::vertex_type vertex)
@@ -90,7 +92,7 @@ namespace internal
 
         for(auto && vertex : this->unmatched_vertices())
         {
-            distances.emplace(vertex, 0.0);
+            distances[vertex] = 0.0;
             vertex_queue.push(vertex);
         }
 
@@ -100,16 +102,18 @@ namespace internal
 
             vertex_queue.pop();
 
-            for(auto && neighbour : this->graph.neighbours(vertex))
-            {
-                auto it = this->matching.find(neighbour);
-
-                if(it != this->matching.end() && distances[it->second.value()] == this->infinity)
-                {
-                    ++distances[vertex];
-                    vertex_queue.push(*it->second);
-                }
-            }
+            this->graph.for_each_neighbour(vertex,
+                    [&](auto && neighbour)
+                    {
+                        auto it = this->matching.find(neighbour);
+
+                        if(it != this->matching.end()
+                                && distances[it->second.value()] == this->infinity)
+                        {
+                            distances[*it->second] = distances[vertex] + 1;
+                            vertex_queue.push(*it->second);
+                        }
+                    });
         }
     }
 
@@ -123,30 +127,32 @@ namespace internal
     {
         visited.insert(vertex);
 
-        for(auto && neighbour : this->graph.neighbours(vertex))
-        {
-            auto it = this->matching.find(neighbour);
-
-            if(it == this->matching.end())
-            {
-                this->matching[vertex] = std::make_optional(neighbour);
-                this->matching[neighbour] = std::make_optional(vertex);
-                return true;
-            }
-
-            auto matched = it->second.value();
-
-            if(visited.find(matched) == visited.end()
-                    && distances.at(matched) == distances.at(vertex) + 1
-                    && dfs(matched, visited, distances))
-            {
-                this->matching[vertex] = std::make_optional(neighbour);
-                this->matching[neighbour] = std::make_optional(vertex);
-                return true;
-            }
-        }
-
-        return false;
+        // stops at the first neighbour that augments the matching
+        return this->graph.any_neighbour(vertex,
+                [&](const typename graph_t::vertex_type & neighbour)
+                {
+                    auto it = this->matching.find(neighbour);
+
+                    if(it == this->matching.end())
+                    {
+                        this->matching[vertex] = std::make_optional(neighbour);
+                        this->matching[neighbour] = std::make_optional(vertex);
+                        return true;
+                    }
+
+                    auto matched = it->second.value();
+
+                    if(visited.find(matched) == visited.end()
+                            && distances.at(matched) == distances.at(vertex) + 1
+                            && this->dfs(matched, visited, distances))
+                    {
+                        this->matching[vertex] = std::make_optional(neighbour);
+                        this->matching[neighbour] = std::make_optional(vertex);
+                        return true;
+                    }
+
+                    return false;
+                });
     }
 }
 
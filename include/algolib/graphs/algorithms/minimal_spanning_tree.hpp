@@ -7,51 +7,23 @@
 
 #include <algorithm>
 #include <queue>
+#include <tuple>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 #include "algolib/graphs/undirected_graph.hpp"
 #include "algolib/structures/disjoint_sets.hpp"
 
 namespace internal
 {
-    namespace algr = algolib::graphs;
-
-    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
-    struct kruskal_cmp
+    // Orders queue entries starting with edge weights, so the lightest entry is on top.
+    template <typename Entry>
+    struct mst_cmp
     {
-        using graph_type = algr::undirected_graph<VertexId, VertexProperty, EdgeProperty>;
-
-        explicit kruskal_cmp(const graph_type & graph) : graph{graph}
+        bool operator()(const Entry & entry1, const Entry & entry2) const
         {
+            return std::get<0>(entry2) < std::get<0>(entry1);
         }
-
-        bool operator()(const typename graph_type::edge_type & edge1,
-                const typename graph_type::edge_type & edge2) const
-        {
-            return graph.properties().at(edge2).weight() < graph.properties().at(edge1).weight();
-        }
-
-        const graph_type & graph;
-    };
-
-    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
-    struct prim_cmp
-    {
-        using graph_type = algr::undirected_graph<VertexId, VertexProperty, EdgeProperty>;
-        using argument_type =
-                std::pair<typename graph_type::edge_type, typename graph_type::vertex_type>;
-
-        explicit prim_cmp(const graph_type & graph) : graph{graph}
-        {
-        }
-
-        bool operator()(const argument_type & pair1, const argument_type & pair2) const
-        {
-            return graph.properties().at(pair2.first).weight()
-                   < graph.properties().at(pair1.first).weight();
-        }
-
-        const graph_type & graph;
     };
 }
 
@@ -68,12 +40,8 @@ namespace algolib::graphs
     undirected_simple_graph<VertexId, VertexProperty, EdgeProperty> kruskal(
             const undirected_graph<VertexId, VertexProperty, EdgeProperty> & graph)
     {
-        using cmp = internal::kruskal_cmp<typename undirected_graph<VertexId, VertexProperty,
-                                                  EdgeProperty>::vertex_id_type,
-                typename undirected_graph<VertexId, VertexProperty,
-                        EdgeProperty>::vertex_property_type,
-                typename undirected_graph<VertexId, VertexProperty,
-                        EdgeProperty>::edge_property_type>;
+        using we_pair = std::pair<double,
+                typename undirected_graph<VertexId, VertexProperty, EdgeProperty>::edge_type>;
 
         std::vector<typename undirected_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type>
                 vertices = graph.vertices();
@@ -99,18 +67,25 @@ namespace algolib::graphs
                 [](auto && vertex) { return vertex.id(); });
 
         undirected_simple_graph<VertexId, VertexProperty, EdgeProperty> mst(vertex_ids);
-        auto edge_queue = std::priority_queue<typename undirected_graph<VertexId, VertexProperty,
-                                                      EdgeProperty>::edge_type,
-                std::vector<typename undirected_graph<VertexId, VertexProperty,
-                        EdgeProperty>::edge_type>,
-                cmp>(cmp(graph));
+        std::vector<we_pair> weighted_edges;
+
+        weighted_edges.reserve(graph.edges_count());
 
-        for(auto && edge : graph.edges())
-            edge_queue.push(edge);
+        // each edge is taken once, from the adjacency of its source vertex
+        for(auto && vertex : vertices)
+            graph.for_each_weighted_edge(vertex,
+                    [&](auto && edge, double weight)
+                    {
+                        if(edge.source() == vertex)
+                            weighted_edges.emplace_back(weight, edge);
+                    });
+
+        std::priority_queue<we_pair, std::vector<we_pair>, internal::mst_cmp<we_pair>> edge_queue(
+                internal::mst_cmp<we_pair>(), std::move(weighted_edges));
 
         while(vertex_sets.size() > 1 && !edge_queue.empty())
         {
-            auto edge = edge_queue.top();
+            auto edge = edge_queue.top().second;
 
             edge_queue.pop();
 
@@ -134,15 +109,9 @@ namespace algolib::graphs
             const undirected_graph<VertexId, VertexProperty, EdgeProperty> & graph,
             typename undirected_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type source)
     {
-        using ev_pair = std::pair<typename undirected_graph<VertexId, VertexProperty,
-                                          EdgeProperty>::edge_type,
+        using wev_tuple = std::tuple<double,
+                typename undirected_graph<VertexId, VertexProperty, EdgeProperty>::edge_type,
                 typename undirected_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type>;
-        using cmp = internal::prim_cmp<typename undirected_graph<VertexId, VertexProperty,
-                                               EdgeProperty>::vertex_id_type,
-                typename undirected_graph<VertexId, VertexProperty,
-                        EdgeProperty>::vertex_property_type,
-                typename undirected_graph<VertexId, VertexProperty,
-                        EdgeProperty>::edge_property_type>;
 
         std::vector<typename undirected_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type>
                 vertices = graph.vertices();
@@ -157,22 +126,23 @@ namespace algolib::graphs
         std::unordered_set<typename undirected_graph<VertexId, VertexProperty,
                 EdgeProperty>::vertex_type>
                 visited;
-        auto queue = std::priority_queue<ev_pair, std::vector<ev_pair>, cmp>(cmp(graph));
+        std::priority_queue<wev_tuple, std::vector<wev_tuple>, internal::mst_cmp<wev_tuple>> queue;
 
         visited.insert(source);
 
-        for(auto && adjacent_edge : graph.adjacent_edges(source))
-        {
-            auto neighbour = adjacent_edge.get_neighbour(source);
+        graph.for_each_weighted_edge(source,
+                [&](auto && adjacent_edge, double weight)
+                {
+                    auto && neighbour = adjacent_edge.get_neighbour(source);
 
-            if(neighbour != source)
-                queue.push(std::make_pair(adjacent_edge, neighbour));
-        }
+                    if(neighbour != source)
+                        queue.push(std::make_tuple(weight, adjacent_edge, neighbour));
+                });
 
         while(!queue.empty())
         {
-            auto edge = queue.top().first;
-            auto vertex = queue.top().second;
+            auto edge = std::get<1>(queue.top());
+            auto vertex = std::get<2>(queue.top());
 
             queue.pop();
 
@@ -182,13 +152,14 @@ namespace algolib::graphs
             {
                 mst.add_edge(edge, graph.properties().at(edge));
 
-                for(auto && adjacent_edge : graph.adjacent_edges(vertex))
-                {
-                    auto neighbour = adjacent_edge.get_neighbour(vertex);
+                graph.for_each_weighted_edge(vertex,
+                        [&](auto && adjacent_edge, double weight)
+                        {
+                            auto && neighbour = adjacent_edge.get_neighbour(vertex);
 
-                    if(visited.find(neighbour) == visited.end())
-                        queue.push(std::make_pair(adjacent_edge, neighbour));
-                }
+                            if(visited.find(neighbour) == visited.end())
+                                queue.push(std::make_tuple(weight, adjacent_edge, neighbour));
+                        });
             }
         }
 
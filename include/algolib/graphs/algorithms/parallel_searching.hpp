@@ -0,0 +1,238 @@
+/**!
+ * \file parallel_searching.hpp
+ * \brief Parallel algorithms for graph searching.
+ */
+#ifndef PARALLEL_SEARCHING_HPP_
+#define PARALLEL_SEARCHING_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "algolib/graphs/frozen_graph.hpp"
+
+namespace internal
+{
+    namespace algr = algolib::graphs;
+
+    // Minimal number of work items processed with more than one thread.
+    constexpr size_t parallel_search_threshold = 1 << 12;
+    // Number of work items taken by a thread at once; a multiple of bits in a bitmap word.
+    constexpr size_t parallel_search_grain = 1 << 10;
+    // Search goes bottom-up when edges from frontier exceed this part of edges from unreached.
+    constexpr size_t bottom_up_factor = 14;
+    // Search goes back top-down when frontier is smaller than this part of all vertices.
+    constexpr size_t top_down_factor = 24;
+
+    // Calls function on consecutive chunks of [0, count), giving the index of calling thread.
+    template <typename Function>
+    void parallel_for(size_t count, size_t threads_count, Function && function)
+    {
+        if(threads_count <= 1 || count < parallel_search_threshold)
+        {
+            function(0, count, 0);
+            return;
+        }
+
+        std::atomic<size_t> next_begin(0);
+        std::vector<std::thread> threads;
+        auto work = [&](size_t thread_index)
+        {
+            for(size_t begin = next_begin.fetch_add(parallel_search_grain); begin < count;
+                    begin = next_begin.fetch_add(parallel_search_grain))
+                function(begin, std::min(begin + parallel_search_grain, count), thread_index);
+        };
+
+        for(size_t i = 1; i < threads_count; ++i)
+            threads.emplace_back(work, i);
+
+        work(0);
+
+        for(auto && thread : threads)
+            thread.join();
+    }
+
+    // Bitmap with bits set concurrently from many threads.
+    class atomic_bitmap
+    {
+    public:
+        explicit atomic_bitmap(size_t size)
+            : words_count{(size + 63) / 64}, words{new std::atomic<uint64_t>[words_count]}
+        {
+            for(size_t i = 0; i < this->words_count; ++i)
+                this->words[i].store(0, std::memory_order_relaxed);
+        }
+
+        bool test(size_t index) const
+        {
+            return (this->words[index / 64].load(std::memory_order_relaxed) >> (index % 64)) & 1;
+        }
+
+        // Sets the bit and checks whether this call has changed it.
+        bool set(size_t index)
+        {
+            uint64_t mask = uint64_t(1) << (index % 64);
+
+            return !this->test(index)
+                   && (this->words[index / 64].fetch_or(mask, std::memory_order_relaxed) & mask)
+                              == 0;
+        }
+
+    private:
+        size_t words_count;
+        std::unique_ptr<std::atomic<uint64_t>[]> words;
+    };
+
+    inline size_t row_size(std::pair<const size_t *, const size_t *> row)
+    {
+        return row.second - row.first;
+    }
+}
+
+namespace algolib::graphs
+{
+    /*!
+     * \brief Distances and parents of vertices found by parallel breadth-first search.
+     * Both are indexed with indices of vertices in the searched graph.
+     */
+    struct parallel_bfs_result
+    {
+        static constexpr size_t unreached = std::numeric_limits<size_t>::max();
+
+        // number of edges from the nearest root, or unreached
+        std::vector<size_t> distances;
+        // index of the previous vertex on a shortest path from the roots, or unreached;
+        // roots are their own parents
+        std::vector<size_t> parents;
+    };
+
+    /*!
+     * \brief Direction-optimising breadth-first search algorithm with level-synchronous frontiers
+     * expanded by many threads.
+     * Frontiers with many edges are expanded bottom-up, by scanning predecessors of unreached
+     * vertices, and others top-down, by scanning neighbours of frontier vertices. When many
+     * vertices of next level have edges from the frontier, the parent is chosen arbitrarily.
+     * \param graph_ the frozen graph
+     * \param roots the starting vertices
+     * \param threads_count the number of threads used for large frontiers
+     * \return the distances and parents of vertices
+     * \throw std::invalid_argument if any root does not belong to the graph
+     */
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    parallel_bfs_result parallel_bfs(const frozen_graph<VertexId, VertexProperty, EdgeProperty> &
+                                             graph_,
+            const std::vector<typename frozen_graph<VertexId, VertexProperty, EdgeProperty>::
+                            vertex_type> & roots,
+            size_t threads_count = std::thread::hardware_concurrency())
+    {
+        size_t vertices_count = graph_.vertices_count();
+        parallel_bfs_result result{
+                std::vector<size_t>(vertices_count, parallel_bfs_result::unreached),
+                std::vector<size_t>(vertices_count, parallel_bfs_result::unreached)};
+        internal::atomic_bitmap reached(vertices_count);
+        std::vector<size_t> frontier;
+        size_t frontier_edges = 0, unreached_edges = 0;
+        bool bottom_up = false;
+
+        threads_count = std::max<size_t>(threads_count, 1);
+
+        std::vector<std::vector<size_t>> next_frontiers(threads_count);
+        std::vector<size_t> next_edges(threads_count);
+
+        for(size_t i = 0; i < vertices_count; ++i)
+            unreached_edges += internal::row_size(graph_.neighbour_indices(i));
+
+        for(auto && root : roots)
+        {
+            size_t index = graph_.index(root);
+
+            if(reached.set(index))
+            {
+                result.distances[index] = 0;
+                result.parents[index] = index;
+                frontier.push_back(index);
+                frontier_edges += internal::row_size(graph_.neighbour_indices(index));
+            }
+        }
+
+        unreached_edges -= frontier_edges;
+
+        for(size_t distance = 1; !frontier.empty(); ++distance)
+        {
+            auto visit = [&](size_t index, size_t parent, size_t thread_index)
+            {
+                result.distances[index] = distance;
+                result.parents[index] = parent;
+                next_frontiers[thread_index].push_back(index);
+                next_edges[thread_index] += internal::row_size(graph_.neighbour_indices(index));
+            };
+
+            if(!bottom_up)
+                bottom_up = frontier_edges > unreached_edges / internal::bottom_up_factor;
+            else
+                bottom_up = frontier.size() >= vertices_count / internal::top_down_factor;
+
+            if(bottom_up)
+            {
+                std::vector<uint64_t> frontier_bits((vertices_count + 63) / 64);
+
+                for(size_t index : frontier)
+                    frontier_bits[index / 64] |= uint64_t(1) << (index % 64);
+
+                internal::parallel_for(vertices_count, threads_count,
+                        [&](size_t begin, size_t end, size_t thread_index)
+                        {
+                            for(size_t index = begin; index < end; ++index)
+                            {
+                                if(reached.test(index))
+                                    continue;
+
+                                auto row = graph_.predecessor_indices(index);
+                                auto it = std::find_if(row.first, row.second,
+                                        [&](size_t predecessor) {
+                                            return (frontier_bits[predecessor / 64]
+                                                           >> (predecessor % 64))
+                                                   & 1;
+                                        });
+
+                                if(it != row.second && reached.set(index))
+                                    visit(index, *it, thread_index);
+                            }
+                        });
+            }
+            else
+                internal::parallel_for(frontier.size(), threads_count,
+                        [&](size_t begin, size_t end, size_t thread_index)
+                        {
+                            for(size_t i = begin; i < end; ++i)
+                            {
+                                auto row = graph_.neighbour_indices(frontier[i]);
+
+                                for(auto it = row.first; it != row.second; ++it)
+                                    if(reached.set(*it))
+                                        visit(*it, frontier[i], thread_index);
+                            }
+                        });
+
+            frontier.clear();
+            frontier_edges = 0;
+
+            for(size_t i = 0; i < threads_count; ++i)
+            {
+                frontier.insert(frontier.end(), next_frontiers[i].begin(), next_frontiers[i].end());
+                frontier_edges += next_edges[i];
+                next_frontiers[i].clear();
+                next_edges[i] = 0;
+            }
+
+            unreached_edges -= frontier_edges;
+        }
+
+        return result;
+    }
+}
+
+#endif
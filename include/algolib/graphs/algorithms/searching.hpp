@@ -6,176 +6,184 @@
 #define SEARCHING_HPP_
 
 #include <algorithm>
-#include <optional>
 #include <queue>
 #include <stack>
-#include <unordered_map>
-#include <unordered_set>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include "algolib/graphs/algorithms/searching_strategy.hpp"
+#include "algolib/graphs/algorithms/vertex_map.hpp"
 #include "algolib/graphs/graph.hpp"
 
 namespace internal
 {
     namespace algr = algolib::graphs;
 
-    template <typename Vertex>
+    template <typename VertexId>
     struct dfs_recursive_state
     {
-        void on_entry(Vertex vertex_)
+        template <typename VertexProperty, typename EdgeProperty>
+        explicit dfs_recursive_state(
+                const algr::graph<VertexId, VertexProperty, EdgeProperty> & graph)
+            : reached{graph}
         {
-            reached[vertex_] = iteration;
         }
 
-        void on_exit(Vertex vertex_)
+        // Vertex on the explicit stack with the position of its next neighbour to visit.
+        struct frame
         {
-            reached[vertex_] = -iteration;
-        }
+            algr::vertex<VertexId> vertex;
+            size_t neighbours_begin;
+            size_t next;
+        };
 
-        std::optional<Vertex> vertex = std::nullopt;
         int iteration = 1;
-        std::unordered_map<Vertex, int> reached = {};
+        vertex_map<VertexId, int> reached;
+        std::vector<frame> frames;
+        // neighbours of all vertices on the stack, each frame owning a suffix above the previous
+        std::vector<algr::vertex<VertexId>> neighbours;
     };
 
-    // Single step of recursive DFS.
-    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    /*
+     * Depth-first search from single root with an explicit stack, calling the hooks in exactly
+     * the same order as a recursive search. A neighbour is checked only when its turn comes, after
+     * all previous neighbours have been searched.
+     */
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty, typename Strategy>
     void dfs_recursive_step(const algr::graph<VertexId, VertexProperty, EdgeProperty> & graph_,
-            algr::dfs_strategy<
-                    typename algr::graph<VertexId, VertexProperty, EdgeProperty>::vertex_type
-            > & strategy,
-            dfs_recursive_state<
-                    typename algr::graph<VertexId, VertexProperty, EdgeProperty>::vertex_type
-            > & state)
+            Strategy & strategy,
+            dfs_recursive_state<VertexId> & state,
+            const algr::vertex<VertexId> & root)
     {
-        typename algr::graph<VertexId, VertexProperty, EdgeProperty>::vertex_type vertex =
-                state.vertex.value();
+        auto enter = [&](const algr::vertex<VertexId> & vertex)
+        {
+            state.reached[vertex] = state.iteration;
+            strategy.on_entry(vertex);
+            state.frames.push_back(typename dfs_recursive_state<VertexId>::frame{
+                    vertex, state.neighbours.size(), state.neighbours.size()});
+            graph_.for_each_neighbour(
+                    vertex, [&](auto && neighbour) { state.neighbours.push_back(neighbour); });
+        };
 
-        state.on_entry(vertex);
-        strategy.on_entry(vertex);
+        enter(root);
 
-        for(auto && neighbour : graph_.neighbours(vertex))
+        while(!state.frames.empty())
         {
-            auto it = state.reached.find(neighbour);
+            auto & top = state.frames.back();
+            algr::vertex<VertexId> vertex = top.vertex;
 
-            if(it == state.reached.end())
+            if(top.next < state.neighbours.size())
             {
-                strategy.on_next_vertex(vertex, neighbour);
-                state.vertex = std::make_optional(neighbour);
-                dfs_recursive_step(graph_, strategy, state);
+                algr::vertex<VertexId> neighbour = state.neighbours[top.next];
+                int * reached = state.reached.find(neighbour);
+
+                ++top.next;
+
+                if(reached == nullptr)
+                {
+                    strategy.on_next_vertex(vertex, neighbour);
+                    enter(neighbour);
+                }
+                else if(*reached == state.iteration)
+                    strategy.on_edge_to_visited(vertex, neighbour);
+            }
+            else
+            {
+                state.neighbours.erase(
+                        state.neighbours.begin() + top.neighbours_begin, state.neighbours.end());
+                state.frames.pop_back();
+                strategy.on_exit(vertex);
+                state.reached[vertex] = -state.iteration;
             }
-            else if(it->second == state.iteration)
-                strategy.on_edge_to_visited(vertex, neighbour);
         }
-
-        strategy.on_exit(vertex);
-        state.on_exit(vertex);
     }
-}
 
-namespace algolib::graphs
-{
-    /*!
-     * \brief Breadth-first search algorithm.
-     * \param graph_ the graph
-     * \param strategy the searching strategy
-     * \param roots the starting vertices
-     * \return the visited vertices
-     */
-    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
-    std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> bfs(
-            const graph<VertexId, VertexProperty, EdgeProperty> & graph_,
-            bfs_strategy<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> &
-                    strategy,
-            std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> roots)
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty, typename Strategy>
+    std::vector<typename algr::graph<VertexId, VertexProperty, EdgeProperty>::vertex_type>
+            bfs_search(const algr::graph<VertexId, VertexProperty, EdgeProperty> & graph_,
+                    Strategy & strategy,
+                    const std::vector<
+                            typename algr::graph<VertexId, VertexProperty, EdgeProperty>::
+                                    vertex_type> & roots)
     {
-        std::unordered_set<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type>
-                reached;
-        std::queue<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type>
+        vertex_map<VertexId, bool> reached(graph_);
+        std::queue<typename algr::graph<VertexId, VertexProperty, EdgeProperty>::vertex_type>
                 vertex_queue;
 
         for(auto && root : roots)
-            if(reached.find(root) == reached.end())
+            if(reached.emplace(root, true))
             {
                 strategy.for_root(root);
                 vertex_queue.push(root);
-                reached.insert(root);
 
                 while(!vertex_queue.empty())
                 {
-                    typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type vertex =
-                            vertex_queue.front();
+                    typename algr::graph<VertexId, VertexProperty, EdgeProperty>::vertex_type
+                            vertex = vertex_queue.front();
 
                     vertex_queue.pop();
                     strategy.on_entry(vertex);
 
-                    for(auto && neighbour : graph_.neighbours(vertex))
-                        if(reached.find(neighbour) == reached.end())
-                        {
-                            strategy.on_next_vertex(vertex, neighbour);
-                            reached.insert(neighbour);
-                            vertex_queue.push(neighbour);
-                        }
+                    graph_.for_each_neighbour(vertex,
+                            [&](auto && neighbour)
+                            {
+                                if(reached.emplace(neighbour, true))
+                                {
+                                    strategy.on_next_vertex(vertex, neighbour);
+                                    vertex_queue.push(neighbour);
+                                }
+                            });
 
                     strategy.on_exit(vertex);
                 }
             }
 
-        return std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type>(
-                reached.begin(), reached.end());
+        return reached.keys();
     }
 
-    /*!
-     * \brief Iterative depth-first search algorithm.
-     * \param graph_ the graph
-     * \param strategy the searching strategy
-     * \param roots the starting vertices
-     * \return the visited vertices
-     */
-    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
-    std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> dfs_iterative(
-            const graph<VertexId, VertexProperty, EdgeProperty> & graph_,
-            dfs_strategy<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> &
-                    strategy,
-            std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> roots)
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty, typename Strategy>
+    std::vector<typename algr::graph<VertexId, VertexProperty, EdgeProperty>::vertex_type>
+            dfs_iterative_search(const algr::graph<VertexId, VertexProperty, EdgeProperty> & graph_,
+                    Strategy & strategy,
+                    const std::vector<
+                            typename algr::graph<VertexId, VertexProperty, EdgeProperty>::
+                                    vertex_type> & roots)
     {
-        std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> visited;
-        std::unordered_map<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type, int>
-                reached;
-        std::stack<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type>
+        vertex_map<VertexId, int> reached(graph_);
+        std::stack<typename algr::graph<VertexId, VertexProperty, EdgeProperty>::vertex_type>
                 vertex_stack;
         int iteration = 1;
 
         for(auto && root : roots)
-            if(reached.find(root) == reached.end())
+            if(!reached.contains(root))
             {
                 strategy.for_root(root);
                 vertex_stack.push(root);
 
                 while(!vertex_stack.empty())
                 {
-                    typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type vertex =
-                            vertex_stack.top();
+                    typename algr::graph<VertexId, VertexProperty, EdgeProperty>::vertex_type
+                            vertex = vertex_stack.top();
 
                     vertex_stack.pop();
 
-                    auto insert_result = reached.emplace(vertex, iteration);
-
-                    if(insert_result.second)
+                    if(reached.emplace(vertex, iteration))
                     {
                         strategy.on_entry(vertex);
 
-                        for(auto && neighbour : graph_.neighbours(vertex))
-                        {
-                            auto it = reached.find(neighbour);
+                        graph_.for_each_neighbour(vertex,
+                                [&](auto && neighbour)
+                                {
+                                    int * neighbour_iteration = reached.find(neighbour);
 
-                            if(it == reached.end())
-                            {
-                                strategy.on_next_vertex(vertex, neighbour);
-                                vertex_stack.push(neighbour);
-                            }
-                            else if(it->second == iteration)
-                                strategy.on_edge_to_visited(vertex, neighbour);
-                        }
+                                    if(neighbour_iteration == nullptr)
+                                    {
+                                        strategy.on_next_vertex(vertex, neighbour);
+                                        vertex_stack.push(neighbour);
+                                    }
+                                    else if(*neighbour_iteration == iteration)
+                                        strategy.on_edge_to_visited(vertex, neighbour);
+                                });
 
                         strategy.on_exit(vertex);
                         reached[vertex] = -iteration;
@@ -185,44 +193,154 @@ namespace algolib::graphs
                 ++iteration;
             }
 
-        std::transform(reached.begin(), reached.end(), std::back_inserter(visited),
-                [](auto && p) { return p.first; });
+        return reached.keys();
+    }
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty, typename Strategy>
+    std::vector<typename algr::graph<VertexId, VertexProperty, EdgeProperty>::vertex_type>
+            dfs_recursive_search(const algr::graph<VertexId, VertexProperty, EdgeProperty> & graph_,
+                    Strategy & strategy,
+                    const std::vector<
+                            typename algr::graph<VertexId, VertexProperty, EdgeProperty>::
+                                    vertex_type> & roots)
+    {
+        dfs_recursive_state<VertexId> state(graph_);
 
-        return visited;
+        for(auto && root : roots)
+            if(!state.reached.contains(root))
+            {
+                strategy.for_root(root);
+                dfs_recursive_step(graph_, strategy, state, root);
+                ++state.iteration;
+            }
+
+        return state.reached.keys();
     }
+}
 
+namespace algolib::graphs
+{
     /*!
-     * \brief Recursive depth-first search algorithm.
+     * \brief Breadth-first search algorithm.
      * \param graph_ the graph
      * \param strategy the searching strategy
      * \param roots the starting vertices
      * \return the visited vertices
      */
     template <typename VertexId, typename VertexProperty, typename EdgeProperty>
-    std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> dfs_recursive(
+    std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> bfs(
+            const graph<VertexId, VertexProperty, EdgeProperty> & graph_,
+            bfs_strategy<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> &
+                    strategy,
+            std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> roots)
+    {
+        return internal::bfs_search(graph_, strategy, roots);
+    }
+
+    /*!
+     * \brief Breadth-first search algorithm with strategy known at compile time.
+     * \tparam Strategy the type of searching strategy with hooks of bfs_strategy, not necessarily
+     * virtual
+     * \param graph_ the graph
+     * \param strategy the searching strategy
+     * \param roots the starting vertices
+     * \return the visited vertices
+     */
+    template <typename VertexId,
+            typename VertexProperty,
+            typename EdgeProperty,
+            typename Strategy,
+            std::enable_if_t<internal::is_static_bfs_strategy_v<Strategy, vertex<VertexId>>, int> =
+                    0>
+    std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> bfs(
+            const graph<VertexId, VertexProperty, EdgeProperty> & graph_,
+            Strategy & strategy,
+            std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> roots)
+    {
+        return internal::bfs_search(graph_, strategy, roots);
+    }
+
+    /*!
+     * \brief Iterative depth-first search algorithm.
+     * \param graph_ the graph
+     * \param strategy the searching strategy
+     * \param roots the starting vertices
+     * \return the visited vertices
+     */
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> dfs_iterative(
             const graph<VertexId, VertexProperty, EdgeProperty> & graph_,
             dfs_strategy<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> &
                     strategy,
             std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> roots)
     {
-        std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> visited;
-        internal::dfs_recursive_state<typename graph<VertexId, VertexProperty,
-                EdgeProperty>::vertex_type>
-                state;
+        return internal::dfs_iterative_search(graph_, strategy, roots);
+    }
 
-        for(auto && root : roots)
-            if(state.reached.find(root) == state.reached.end())
-            {
-                strategy.for_root(root);
-                state.vertex = std::make_optional(root);
-                internal::dfs_recursive_step(graph_, strategy, state);
-                ++state.iteration;
-            }
+    /*!
+     * \brief Iterative depth-first search algorithm with strategy known at compile time.
+     * \tparam Strategy the type of searching strategy with hooks of dfs_strategy, not necessarily
+     * virtual
+     * \param graph_ the graph
+     * \param strategy the searching strategy
+     * \param roots the starting vertices
+     * \return the visited vertices
+     */
+    template <typename VertexId,
+            typename VertexProperty,
+            typename EdgeProperty,
+            typename Strategy,
+            std::enable_if_t<internal::is_static_dfs_strategy_v<Strategy, vertex<VertexId>>, int> =
+                    0>
+    std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> dfs_iterative(
+            const graph<VertexId, VertexProperty, EdgeProperty> & graph_,
+            Strategy & strategy,
+            std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> roots)
+    {
+        return internal::dfs_iterative_search(graph_, strategy, roots);
+    }
 
-        std::transform(state.reached.begin(), state.reached.end(), std::back_inserter(visited),
-                [](auto && p) { return p.first; });
+    /*!
+     * \brief Recursive depth-first search algorithm.
+     * Recursion is simulated with an explicit stack, so searching deep graphs does not exhaust the
+     * call stack, while the strategy receives events in the recursive order.
+     * \param graph_ the graph
+     * \param strategy the searching strategy
+     * \param roots the starting vertices
+     * \return the visited vertices
+     */
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> dfs_recursive(
+            const graph<VertexId, VertexProperty, EdgeProperty> & graph_,
+            dfs_strategy<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> &
+                    strategy,
+            std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> roots)
+    {
+        return internal::dfs_recursive_search(graph_, strategy, roots);
+    }
 
-        return visited;
+    /*!
+     * \brief Recursive depth-first search algorithm with strategy known at compile time.
+     * Recursion is simulated with an explicit stack, like in the overload with virtual strategy.
+     * \tparam Strategy the type of searching strategy with hooks of dfs_strategy, not necessarily
+     * virtual
+     * \param graph_ the graph
+     * \param strategy the searching strategy
+     * \param roots the starting vertices
+     * \return the visited vertices
+     */
+    template <typename VertexId,
+            typename VertexProperty,
+            typename EdgeProperty,
+            typename Strategy,
+            std::enable_if_t<internal::is_static_dfs_strategy_v<Strategy, vertex<VertexId>>, int> =
+                    0>
+    std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> dfs_recursive(
+            const graph<VertexId, VertexProperty, EdgeProperty> & graph_,
+            Strategy & strategy,
+            std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> roots)
+    {
+        return internal::dfs_recursive_search(graph_, strategy, roots);
     }
 }
 
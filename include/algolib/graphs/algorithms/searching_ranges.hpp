@@ -0,0 +1,346 @@
+/**!
+ * \file searching_ranges.hpp
+ * \brief Lazy ranges of vertices in searching order.
+ */
+#ifndef SEARCHING_RANGES_HPP_
+#define SEARCHING_RANGES_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <queue>
+#include <utility>
+#include <vector>
+#include "algolib/graphs/algorithms/searching.hpp"
+#include "algolib/graphs/algorithms/vertex_map.hpp"
+#include "algolib/graphs/graph.hpp"
+
+namespace internal
+{
+    // Single-pass iterator over vertices of a searching range, which advances the search itself.
+    template <typename Range>
+    class searching_iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = typename Range::vertex_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type *;
+        using reference = const value_type &;
+
+        explicit searching_iterator(Range * range = nullptr) : range{range}
+        {
+        }
+
+        ~searching_iterator() = default;
+        searching_iterator(const searching_iterator &) = default;
+        searching_iterator(searching_iterator &&) = default;
+        searching_iterator & operator=(const searching_iterator &) = default;
+        searching_iterator & operator=(searching_iterator &&) = default;
+
+        reference operator*() const
+        {
+            return this->range->current();
+        }
+
+        pointer operator->() const
+        {
+            return &this->range->current();
+        }
+
+        searching_iterator & operator++()
+        {
+            this->range->advance();
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        friend bool operator==(const searching_iterator & it1, const searching_iterator & it2)
+        {
+            return it1.finished() == it2.finished();
+        }
+
+        friend bool operator!=(const searching_iterator & it1, const searching_iterator & it2)
+        {
+            return !(it1 == it2);
+        }
+
+    private:
+        bool finished() const
+        {
+            return this->range == nullptr || this->range->finished();
+        }
+
+        Range * range;
+    };
+}
+
+namespace algolib::graphs
+{
+    /*!
+     * \brief Range of vertices in order of breadth-first search, which is run while iterating.
+     * Neighbours of a vertex are searched only after iterating past it, so stopping early costs
+     * only the explored part of the graph. Iteration can be stopped and resumed from the vertex it
+     * stopped at, as the range keeps the state of the search. The graph must not be modified while
+     * iterating.
+     */
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    class bfs_range
+    {
+    public:
+        using graph_type = graph<VertexId, VertexProperty, EdgeProperty>;
+        using vertex_type = typename graph_type::vertex_type;
+        using iterator = internal::searching_iterator<bfs_range>;
+
+        /*!
+         * \param graph_ the graph
+         * \param roots the starting vertices
+         */
+        bfs_range(const graph_type & graph_, std::vector<vertex_type> roots)
+            : graph_{graph_}, roots{std::move(roots)}, depths{graph_}
+        {
+            this->advance();
+        }
+
+        ~bfs_range() = default;
+        bfs_range(const bfs_range &) = delete;
+        bfs_range(bfs_range &&) = delete;
+        bfs_range & operator=(const bfs_range &) = delete;
+        bfs_range & operator=(bfs_range &&) = delete;
+
+        /*!
+         * \return the iterator at the current vertex of the search
+         */
+        iterator begin()
+        {
+            return iterator(this);
+        }
+
+        /*!
+         * \return the iterator past the last vertex of the search
+         */
+        iterator end()
+        {
+            return iterator();
+        }
+
+        /*!
+         * \brief Gets the number of edges from the root of the search to the current vertex.
+         * \return the depth of the current vertex
+         */
+        size_t depth() const
+        {
+            return *this->depths.find(this->current());
+        }
+
+    private:
+        const vertex_type & current() const
+        {
+            return *this->current_;
+        }
+
+        bool finished() const
+        {
+            return !this->current_;
+        }
+
+        void advance();
+
+        const graph_type & graph_;
+        std::vector<vertex_type> roots;
+        size_t next_root = 0;
+        internal::vertex_map<VertexId, size_t> depths;
+        std::queue<vertex_type> vertex_queue;
+        std::optional<vertex_type> current_;
+
+        friend iterator;
+    };
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    void bfs_range<VertexId, VertexProperty, EdgeProperty>::advance()
+    {
+        if(this->current_)
+        {
+            size_t depth = this->depth();
+
+            this->graph_.for_each_neighbour(*this->current_,
+                    [&](auto && neighbour)
+                    {
+                        if(this->depths.emplace(neighbour, depth + 1))
+                            this->vertex_queue.push(neighbour);
+                    });
+        }
+
+        for(; this->vertex_queue.empty() && this->next_root < this->roots.size(); ++this->next_root)
+            if(this->depths.emplace(this->roots[this->next_root], 0))
+                this->vertex_queue.push(this->roots[this->next_root]);
+
+        if(this->vertex_queue.empty())
+        {
+            this->current_ = std::nullopt;
+            return;
+        }
+
+        this->current_ = std::make_optional(this->vertex_queue.front());
+        this->vertex_queue.pop();
+    }
+
+    /*!
+     * \brief Range of vertices in order of depth-first search, which is run while iterating.
+     * Vertices come in order of entering them by recursive depth-first search. Neighbours of a
+     * vertex are searched only when iterating past it, so stopping early costs only the explored
+     * part of the graph. Iteration can be stopped and resumed from the vertex it stopped at, as the
+     * range keeps the state of the search. The graph must not be modified while iterating.
+     */
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    class dfs_range
+    {
+    public:
+        using graph_type = graph<VertexId, VertexProperty, EdgeProperty>;
+        using vertex_type = typename graph_type::vertex_type;
+        using iterator = internal::searching_iterator<dfs_range>;
+
+        /*!
+         * \param graph_ the graph
+         * \param roots the starting vertices
+         */
+        dfs_range(const graph_type & graph_, std::vector<vertex_type> roots)
+            : graph_{graph_}, roots{std::move(roots)}, state{graph_}
+        {
+            this->advance();
+        }
+
+        ~dfs_range() = default;
+        dfs_range(const dfs_range &) = delete;
+        dfs_range(dfs_range &&) = delete;
+        dfs_range & operator=(const dfs_range &) = delete;
+        dfs_range & operator=(dfs_range &&) = delete;
+
+        /*!
+         * \return the iterator at the current vertex of the search
+         */
+        iterator begin()
+        {
+            return iterator(this);
+        }
+
+        /*!
+         * \return the iterator past the last vertex of the search
+         */
+        iterator end()
+        {
+            return iterator();
+        }
+
+        /*!
+         * \brief Gets the number of edges on the search path from the root to the current vertex.
+         * \return the depth of the current vertex
+         */
+        size_t depth() const
+        {
+            return this->state.frames.size() - 1;
+        }
+
+    private:
+        const vertex_type & current() const
+        {
+            return this->state.frames.back().vertex;
+        }
+
+        bool finished() const
+        {
+            return this->state.frames.empty();
+        }
+
+        void enter(const vertex_type & vertex);
+        void advance();
+
+        const graph_type & graph_;
+        std::vector<vertex_type> roots;
+        size_t next_root = 0;
+        internal::dfs_recursive_state<VertexId> state;
+
+        friend iterator;
+    };
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    void dfs_range<VertexId, VertexProperty, EdgeProperty>::enter(const vertex_type & vertex)
+    {
+        this->state.reached[vertex] = this->state.iteration;
+        this->state.frames.push_back(typename internal::dfs_recursive_state<VertexId>::frame{
+                vertex, this->state.neighbours.size(), this->state.neighbours.size()});
+        this->graph_.for_each_neighbour(
+                vertex, [&](auto && neighbour) { this->state.neighbours.push_back(neighbour); });
+    }
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    void dfs_range<VertexId, VertexProperty, EdgeProperty>::advance()
+    {
+        while(!this->state.frames.empty())
+        {
+            auto & top = this->state.frames.back();
+
+            if(top.next < this->state.neighbours.size())
+            {
+                vertex_type neighbour = this->state.neighbours[top.next];
+
+                ++top.next;
+
+                if(!this->state.reached.contains(neighbour))
+                {
+                    this->enter(neighbour);
+                    return;
+                }
+            }
+            else
+            {
+                this->state.reached[top.vertex] = -this->state.iteration;
+                this->state.neighbours.erase(this->state.neighbours.begin() + top.neighbours_begin,
+                        this->state.neighbours.end());
+                this->state.frames.pop_back();
+            }
+        }
+
+        for(; this->next_root < this->roots.size(); ++this->next_root)
+            if(!this->state.reached.contains(this->roots[this->next_root]))
+            {
+                ++this->state.iteration;
+                this->enter(this->roots[this->next_root]);
+                return;
+            }
+    }
+
+    /*!
+     * \brief Lazy breadth-first search algorithm.
+     * \param graph_ the graph
+     * \param roots the starting vertices
+     * \return the range of vertices in searching order
+     */
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    bfs_range<VertexId, VertexProperty, EdgeProperty> lazy_bfs(
+            const graph<VertexId, VertexProperty, EdgeProperty> & graph_,
+            std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> roots)
+    {
+        return bfs_range<VertexId, VertexProperty, EdgeProperty>(graph_, std::move(roots));
+    }
+
+    /*!
+     * \brief Lazy depth-first search algorithm.
+     * \param graph_ the graph
+     * \param roots the starting vertices
+     * \return the range of vertices in searching order
+     */
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    dfs_range<VertexId, VertexProperty, EdgeProperty> lazy_dfs(
+            const graph<VertexId, VertexProperty, EdgeProperty> & graph_,
+            std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type> roots)
+    {
+        return dfs_range<VertexId, VertexProperty, EdgeProperty>(graph_, std::move(roots));
+    }
+}
+
+#endif
@@ -5,6 +5,9 @@
 #ifndef SEARCHING_STRATEGY_HPP_
 #define SEARCHING_STRATEGY_HPP_
 
+#include <type_traits>
+#include <utility>
+
 namespace algolib::graphs
 {
     template <typename Vertex>
@@ -52,6 +55,79 @@ namespace algolib::graphs
         {
         }
     };
+
+    /*!
+     * \brief Searching strategy resolved at compile time with all hooks doing nothing.
+     * Derived strategies hide only the hooks they need; the others are inlined away by the
+     * template overloads of searching algorithms.
+     */
+    template <typename Vertex>
+    struct static_strategy
+    {
+        void for_root(const Vertex &)
+        {
+        }
+
+        void on_entry(const Vertex &)
+        {
+        }
+
+        void on_next_vertex(const Vertex &, const Vertex &)
+        {
+        }
+
+        void on_exit(const Vertex &)
+        {
+        }
+
+        void on_edge_to_visited(const Vertex &, const Vertex &)
+        {
+        }
+    };
+}
+
+namespace internal
+{
+    template <typename Strategy, typename Vertex, typename = void>
+    struct is_bfs_strategy : std::false_type
+    {
+    };
+
+    template <typename Strategy, typename Vertex>
+    struct is_bfs_strategy<Strategy,
+            Vertex,
+            std::void_t<decltype(std::declval<Strategy &>().for_root(std::declval<Vertex>())),
+                    decltype(std::declval<Strategy &>().on_entry(std::declval<Vertex>())),
+                    decltype(std::declval<Strategy &>().on_next_vertex(
+                            std::declval<Vertex>(), std::declval<Vertex>())),
+                    decltype(std::declval<Strategy &>().on_exit(std::declval<Vertex>()))>>
+        : std::true_type
+    {
+    };
+
+    template <typename Strategy, typename Vertex, typename = void>
+    struct is_dfs_strategy : std::false_type
+    {
+    };
+
+    template <typename Strategy, typename Vertex>
+    struct is_dfs_strategy<Strategy,
+            Vertex,
+            std::void_t<decltype(std::declval<Strategy &>().on_edge_to_visited(
+                    std::declval<Vertex>(), std::declval<Vertex>()))>>
+        : is_bfs_strategy<Strategy, Vertex>
+    {
+    };
+
+    // Strategies taken by template overloads of searching algorithms; abstract strategy
+    // interfaces are left to the overloads taking them, which forward with virtual calls.
+    template <typename Strategy, typename Vertex>
+    constexpr bool is_static_bfs_strategy_v =
+            is_bfs_strategy<Strategy, Vertex>::value && !std::is_abstract_v<Strategy>;
+
+    template <typename Strategy, typename Vertex>
+    constexpr bool is_static_dfs_strategy_v =
+            is_dfs_strategy<Strategy, Vertex>::value && !std::is_abstract_v<Strategy>;
 }
 
 #endif
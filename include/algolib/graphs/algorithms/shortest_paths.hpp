@@ -7,28 +7,789 @@
 
 #include <cmath>
 #include <algorithm>
-#include <queue>
+#include <atomic>
+#include <deque>
+#include <limits>
+#include <optional>
 #include <stdexcept>
+#include <thread>
 #include <unordered_map>
-#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "algolib/geometry/dim2/geometry_2d.hpp"
+#include "algolib/geometry/dim3/geometry_3d.hpp"
+#include "algolib/graphs/algorithms/vertex_map.hpp"
 #include "algolib/graphs/directed_graph.hpp"
+#include "algolib/graphs/undirected_graph.hpp"
 
 namespace internal
 {
     namespace algr = algolib::graphs;
 
-    template <typename Argument>
-    struct dijkstra_cmp
+    // Indexed 4-ary min-heap of slots ordered by their keys, with keys decreased in place.
+    template <typename Key>
+    class indexed_heap
     {
-        bool operator()(const Argument & pair1, const Argument & pair2) const
+    public:
+        static constexpr size_t arity = 4;
+
+        bool empty() const
+        {
+            return this->entries.empty();
+        }
+
+        const Key & top_key() const
+        {
+            return this->entries.front().first;
+        }
+
+        // Inserts the slot or decreases its key if the slot is already in the heap.
+        void push(size_t slot, const Key & key)
+        {
+            if(slot >= this->positions.size())
+                this->positions.resize(slot + 1, absent);
+
+            size_t position = this->positions[slot];
+
+            if(position == absent)
+            {
+                position = this->entries.size();
+                this->entries.emplace_back(key, slot);
+            }
+            else
+                this->entries[position].first = key;
+
+            this->sift_up(position);
+        }
+
+        size_t pop()
+        {
+            size_t slot = this->entries.front().second;
+
+            this->positions[slot] = absent;
+            this->entries.front() = this->entries.back();
+            this->entries.pop_back();
+
+            if(!this->entries.empty())
+                this->sift_down(0);
+
+            return slot;
+        }
+
+    private:
+        static constexpr size_t absent = std::numeric_limits<size_t>::max();
+
+        void place(size_t position, const std::pair<Key, size_t> & entry)
+        {
+            this->entries[position] = entry;
+            this->positions[entry.second] = position;
+        }
+
+        void sift_up(size_t position)
+        {
+            std::pair<Key, size_t> entry = this->entries[position];
+
+            while(position > 0)
+            {
+                size_t parent = (position - 1) / arity;
+
+                if(!(entry.first < this->entries[parent].first))
+                    break;
+
+                this->place(position, this->entries[parent]);
+                position = parent;
+            }
+
+            this->place(position, entry);
+        }
+
+        void sift_down(size_t position)
+        {
+            std::pair<Key, size_t> entry = this->entries[position];
+
+            for(size_t first = arity * position + 1; first < this->entries.size();
+                    first = arity * position + 1)
+            {
+                size_t last = std::min(first + arity, this->entries.size());
+                size_t child = first;
+
+                for(size_t i = first + 1; i < last; ++i)
+                    if(this->entries[i].first < this->entries[child].first)
+                        child = i;
+
+                if(!(this->entries[child].first < entry.first))
+                    break;
+
+                this->place(position, this->entries[child]);
+                position = child;
+            }
+
+            this->place(position, entry);
+        }
+
+        std::vector<std::pair<Key, size_t>> entries;
+        // positions of slots in entries, absent for slots outside the heap
+        std::vector<size_t> positions;
+    };
+
+    // Vertices reached while searching for shortest paths, numbered with slots in order of
+    // reaching from the source at slot zero, with distances and slots of predecessors kept in flat
+    // arrays. In graphs with indexed vertices slots are found by indices of vertices, and the map
+    // from vertices to slots is only filled for queries on the result.
+    template <typename VertexId, typename Weight>
+    struct paths_state
+    {
+        static constexpr size_t no_predecessor = std::numeric_limits<size_t>::max();
+        static constexpr size_t no_slot = std::numeric_limits<size_t>::max();
+
+        template <typename VertexProperty, typename EdgeProperty>
+        paths_state(const algr::graph<VertexId, VertexProperty, EdgeProperty> & graph,
+                const algr::vertex<VertexId> & source)
+            : slots{graph}
+        {
+            if(graph.is_indexed())
+            {
+                this->index_slots.assign(graph.vertices_count(), no_slot);
+                this->distances[this->reach(graph.index(source), source)] = 0.0;
+            }
+            else
+                this->distances[this->reach(source)] = 0.0;
+        }
+
+        bool indexed() const
+        {
+            return !this->index_slots.empty();
+        }
+
+        // Gets the slot of the vertex, adding it with infinite distance if not reached yet.
+        size_t reach(const algr::vertex<VertexId> & vertex)
+        {
+            size_t * slot = this->slots.find(vertex);
+
+            return slot != nullptr ? *slot : this->add(vertex);
+        }
+
+        // Gets the slot of the vertex at given index in the graph with indexed vertices, adding it
+        // with infinite distance if not reached yet.
+        size_t reach(size_t index, const algr::vertex<VertexId> & vertex)
+        {
+            if(this->index_slots[index] == no_slot)
+            {
+                this->index_slots[index] = this->add(vertex);
+                this->vertex_indices.push_back(index);
+            }
+
+            return this->index_slots[index];
+        }
+
+        // Adds the vertex at new slot with infinite distance.
+        size_t add(const algr::vertex<VertexId> & vertex)
+        {
+            this->slots.emplace(vertex, this->vertices.size());
+            this->vertices.push_back(vertex);
+            this->distances.push_back(algr::weighted::infinity);
+            this->predecessors.push_back(no_predecessor);
+            return this->vertices.size() - 1;
+        }
+
+        // Gets the slot of the vertex at given slot in the other state over the same graph, or
+        // nothing if the vertex is not reached yet.
+        const size_t * find(const paths_state & other, size_t other_slot) const
+        {
+            if(this->indexed())
+            {
+                const size_t & slot = this->index_slots[other.vertex_indices[other_slot]];
+
+                return slot == no_slot ? nullptr : &slot;
+            }
+
+            return this->slots.find(other.vertices[other_slot]);
+        }
+
+        // Gets the vertices on the path from the source to the vertex at given slot.
+        std::vector<algr::vertex<VertexId>> path(size_t slot) const
+        {
+            std::vector<algr::vertex<VertexId>> result;
+
+            for(size_t i = slot; i != no_predecessor; i = this->predecessors[i])
+                result.push_back(this->vertices[i]);
+
+            std::reverse(result.begin(), result.end());
+            return result;
+        }
+
+        vertex_map<VertexId, size_t> slots;
+        std::vector<algr::vertex<VertexId>> vertices;
+        std::vector<Weight> distances;
+        std::vector<size_t> predecessors;
+        // slots of vertices at indices in the graph, empty if vertices are not indexed
+        std::vector<size_t> index_slots;
+        // indices in the graph of vertices at slots, empty if vertices are not indexed
+        std::vector<size_t> vertex_indices;
+    };
+
+    /*
+     * Relaxes edges from the vertex at given slot, which has its final distance. Edges are given
+     * by calling for_each_edge with the state, the slot and a function of slot of the neighbour
+     * and weight. Improved vertices are pushed to the heap with key given by priority of their
+     * slot and distance. The on_edge function gets every edge as the slot of the neighbour and the
+     * distance through this edge.
+     */
+    template <typename VertexId,
+            typename Weight,
+            typename ForEachEdge,
+            typename Priority,
+            typename OnEdge>
+    void dijkstra_relax(paths_state<VertexId, Weight> & state,
+            indexed_heap<Weight> & heap,
+            size_t slot,
+            ForEachEdge && for_each_edge,
+            Priority && priority,
+            OnEdge && on_edge)
+    {
+        Weight distance = state.distances[slot];
+
+        for_each_edge(state, slot,
+                [&](size_t neighbour_slot, double weight)
+                {
+                    if(weight < 0.0)
+                        throw std::logic_error("Graph contains an edge with negative weight");
+
+                    if(distance + weight < state.distances[neighbour_slot])
+                    {
+                        state.distances[neighbour_slot] = distance + weight;
+                        state.predecessors[neighbour_slot] = slot;
+                        heap.push(neighbour_slot, priority(neighbour_slot, distance + weight));
+                    }
+
+                    on_edge(neighbour_slot, distance + weight);
+                });
+    }
+
+    // Gives outgoing edges of vertices at slots in the graph to searches for shortest paths,
+    // reaching their neighbours in the state.
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    auto outgoing_edges(const algr::graph<VertexId, VertexProperty, EdgeProperty> & graph_)
+    {
+        return [&](auto & state, size_t slot, auto && function)
+        {
+            if(state.indexed())
+            {
+                graph_.for_each_indexed_weighted_edge(state.vertex_indices[slot],
+                        [&](size_t index, const algr::vertex<VertexId> & neighbour, double weight)
+                        { function(state.reach(index, neighbour), weight); });
+                return;
+            }
+
+            // copied, as reaching neighbours may reallocate vertices in the state
+            algr::vertex<VertexId> vertex = state.vertices[slot];
+
+            graph_.for_each_weighted_edge(vertex,
+                    [&](auto && edge, double weight)
+                    { function(state.reach(edge.get_neighbour(vertex)), weight); });
+        };
+    }
+
+    // Gives incoming edges of vertices at slots in the directed graph to searches for shortest
+    // paths, reaching their sources in the state.
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    auto incoming_edges(const algr::directed_graph<VertexId, VertexProperty, EdgeProperty> & graph)
+    {
+        return [&](auto & state, size_t slot, auto && function)
+        {
+            if(state.indexed())
+            {
+                graph.for_each_incoming_indexed_weighted_edge(state.vertex_indices[slot],
+                        [&](size_t index, const algr::vertex<VertexId> & source, double weight)
+                        { function(state.reach(index, source), weight); });
+                return;
+            }
+
+            algr::vertex<VertexId> vertex = state.vertices[slot];
+
+            graph.for_each_incoming_weighted_edge(vertex,
+                    [&](auto && edge, double weight)
+                    { function(state.reach(edge.source()), weight); });
+        };
+    }
+
+    // Follows predecessors from given slot and gets the vertices on the first repeated cycle in
+    // order of edges, or nothing if the source is reached. Slots are marked as visited with given
+    // mark, different in each call, so the marks are reused without clearing.
+    template <typename VertexId, typename Weight>
+    std::vector<algr::vertex<VertexId>> find_predecessors_cycle(
+            const paths_state<VertexId, Weight> & state,
+            size_t slot,
+            std::vector<size_t> & marks,
+            size_t mark)
+    {
+        std::vector<algr::vertex<VertexId>> cycle;
+
+        marks.resize(state.vertices.size());
+
+        for(; slot != paths_state<VertexId, Weight>::no_predecessor && marks[slot] != mark;
+                slot = state.predecessors[slot])
+            marks[slot] = mark;
+
+        if(slot == paths_state<VertexId, Weight>::no_predecessor)
+            return cycle;
+
+        size_t cycle_slot = slot;
+
+        do
+        {
+            cycle.push_back(state.vertices[cycle_slot]);
+            cycle_slot = state.predecessors[cycle_slot];
+        } while(cycle_slot != slot);
+
+        std::reverse(cycle.begin(), cycle.end());
+        return cycle;
+    }
+
+    inline double euclidean_distance(const algolib::geometry::dim2::point_2d & point1,
+            const algolib::geometry::dim2::point_2d & point2)
+    {
+        return algolib::geometry::dim2::distance(point1, point2);
+    }
+
+    inline double euclidean_distance(const algolib::geometry::dim3::point_3d & point1,
+            const algolib::geometry::dim3::point_3d & point2)
+    {
+        return algolib::geometry::dim3::distance(point1, point2);
+    }
+
+    inline double manhattan_distance(const algolib::geometry::dim2::point_2d & point1,
+            const algolib::geometry::dim2::point_2d & point2)
+    {
+        return algolib::geometry::dim2::manhattan_distance(point1, point2);
+    }
+
+    inline double manhattan_distance(const algolib::geometry::dim3::point_3d & point1,
+            const algolib::geometry::dim3::point_3d & point2)
+    {
+        return algolib::geometry::dim3::manhattan_distance(point1, point2);
+    }
+
+    template <typename Weight>
+    Weight distance_priority(size_t, Weight distance)
+    {
+        return distance;
+    }
+
+    // Runs Dijkstra algorithm until the queue is empty or the stop condition for popped slot holds.
+    template <typename VertexId,
+            typename VertexProperty,
+            typename EdgeProperty,
+            typename Weight,
+            typename Stop>
+    void dijkstra_search(const algr::graph<VertexId, VertexProperty, EdgeProperty> & graph_,
+            paths_state<VertexId, Weight> & state,
+            Stop && stop)
+    {
+        indexed_heap<Weight> heap;
+
+        heap.push(0, state.distances[0]);
+
+        while(!heap.empty())
+        {
+            size_t slot = heap.pop();
+
+            if(stop(slot))
+                return;
+
+            dijkstra_relax(state, heap, slot, outgoing_edges(graph_), distance_priority<Weight>,
+                    [](size_t, Weight) {});
+        }
+    }
+
+    /*
+     * Runs Dijkstra algorithm from the source forwards and from the target backwards, taking
+     * a step on the side with closer vertex, until no path through unsettled vertices can be
+     * shorter than the best path found. Edges going backwards are given by backward_edges.
+     */
+    template <typename VertexId,
+            typename VertexProperty,
+            typename EdgeProperty,
+            typename Weight,
+            typename BackwardEdges>
+    std::pair<Weight, std::vector<algr::vertex<VertexId>>> bidirectional_search(
+            const algr::graph<VertexId, VertexProperty, EdgeProperty> & graph_,
+            const algr::vertex<VertexId> & source,
+            const algr::vertex<VertexId> & target,
+            BackwardEdges && backward_edges)
+    {
+        paths_state<VertexId, Weight> forward(graph_, source), backward(graph_, target);
+        indexed_heap<Weight> forward_heap, backward_heap;
+        Weight best = algr::weighted::infinity;
+        // slots of ends of the middle edge on the best path in forward and backward search
+        std::pair<size_t, size_t> middle;
+
+        if(source == target)
+            return std::make_pair(Weight(0.0), std::vector<algr::vertex<VertexId>>({source}));
+
+        forward_heap.push(0, 0.0);
+        backward_heap.push(0, 0.0);
+
+        auto meet = [&](Weight distance, size_t forward_slot, size_t backward_slot)
+        {
+            if(distance < best)
+            {
+                best = distance;
+                middle = std::make_pair(forward_slot, backward_slot);
+            }
+        };
+
+        while(!forward_heap.empty() && !backward_heap.empty()
+              && forward_heap.top_key() + backward_heap.top_key() < best)
+            if(forward_heap.top_key() <= backward_heap.top_key())
+            {
+                size_t slot = forward_heap.pop();
+
+                dijkstra_relax(forward, forward_heap, slot, outgoing_edges(graph_),
+                        distance_priority<Weight>,
+                        [&](size_t neighbour_slot, Weight distance)
+                        {
+                            const size_t * backward_slot = backward.find(forward, neighbour_slot);
+
+                            if(backward_slot != nullptr)
+                                meet(distance + backward.distances[*backward_slot], slot,
+                                        *backward_slot);
+                        });
+            }
+            else
+            {
+                size_t slot = backward_heap.pop();
+
+                dijkstra_relax(backward, backward_heap, slot, backward_edges,
+                        distance_priority<Weight>,
+                        [&](size_t neighbour_slot, Weight distance)
+                        {
+                            const size_t * forward_slot = forward.find(backward, neighbour_slot);
+
+                            if(forward_slot != nullptr)
+                                meet(distance + forward.distances[*forward_slot], *forward_slot,
+                                        slot);
+                        });
+            }
+
+        if(best == algr::weighted::infinity)
+            return std::make_pair(best, std::vector<algr::vertex<VertexId>>());
+
+        std::vector<algr::vertex<VertexId>> path = forward.path(middle.first);
+        std::vector<algr::vertex<VertexId>> backward_path = backward.path(middle.second);
+
+        path.insert(path.end(), backward_path.rbegin(), backward_path.rend());
+        return std::make_pair(best, path);
+    }
+
+    // Side of square tiles relaxed together, so that three tiles of distances fit in L1 cache.
+    constexpr size_t floyd_warshall_tile = 64;
+
+    // Dense all-pairs distances with vertices mapped to indices. Rows are padded to a multiple of
+    // the tile, so that every tile is full; padding cells are never reachable.
+    template <typename VertexId>
+    struct matrix_state
+    {
+        static constexpr size_t no_hop = std::numeric_limits<size_t>::max();
+
+        template <typename VertexProperty, typename EdgeProperty>
+        matrix_state(const algr::graph<VertexId, VertexProperty, EdgeProperty> & graph,
+                bool with_paths)
+            : indices{graph}, vertices{graph.vertices()}
+        {
+            this->stride = (this->vertices.size() + floyd_warshall_tile - 1) / floyd_warshall_tile
+                           * floyd_warshall_tile;
+            this->distances.assign(this->stride * this->stride, algr::weighted::infinity);
+
+            if(with_paths)
+                this->next_hops.assign(this->stride * this->stride, no_hop);
+
+            for(size_t i = 0; i < this->vertices.size(); ++i)
+                this->indices.emplace(this->vertices[i], i);
+
+            for(size_t i = 0; i < this->stride; ++i)
+                this->cell(i, i) = 0.0;
+
+            for(size_t i = 0; i < this->vertices.size(); ++i)
+            {
+                if(with_paths)
+                    this->next_hops[i * this->stride + i] = i;
+
+                graph.for_each_weighted_edge(this->vertices[i],
+                        [&](auto && edge, double weight)
+                        {
+                            size_t j = *this->indices.find(edge.destination());
+
+                            if(weight < this->cell(i, j))
+                            {
+                                this->cell(i, j) = weight;
+
+                                if(with_paths)
+                                    this->next_hops[i * this->stride + j] = j;
+                            }
+                        });
+            }
+        }
+
+        double & cell(size_t i, size_t j)
         {
-            return pair2.first < pair1.first;
+            return this->distances[i * this->stride + j];
         }
+
+        vertex_map<VertexId, size_t> indices;
+        std::vector<algr::vertex<VertexId>> vertices;
+        size_t stride = 0;
+        // row-major distances, stride cells in each row
+        std::vector<double> distances;
+        // row-major indices of second vertices on shortest paths, empty if not computed
+        std::vector<size_t> next_hops;
     };
+
+    // Relaxes distances in tile of given first row and column through vertices of given tile.
+    // The inner loop has constant length and no branches, so that it is vectorised.
+    inline void relax_tile(double * distances, size_t stride, size_t row, size_t column,
+            size_t through)
+    {
+        for(size_t k = through; k < through + floyd_warshall_tile; ++k)
+        {
+            const double * through_row = distances + k * stride + column;
+
+            for(size_t i = row; i < row + floyd_warshall_tile; ++i)
+            {
+                double * cells = distances + i * stride + column;
+                double to_through = distances[i * stride + k];
+
+#pragma GCC ivdep
+                for(size_t j = 0; j < floyd_warshall_tile; ++j)
+                    cells[j] = std::min(cells[j], to_through + through_row[j]);
+            }
+        }
+    }
+
+    // Relaxes distances in tile like relax_tile and updates next hops of improved paths. The
+    // inner loop is branch-free, yet it is vectorised only where masked blends are cheap.
+    inline void relax_tile(double * distances, size_t * next_hops, size_t stride, size_t row,
+            size_t column, size_t through)
+    {
+        for(size_t k = through; k < through + floyd_warshall_tile; ++k)
+        {
+            const double * through_row = distances + k * stride + column;
+
+            for(size_t i = row; i < row + floyd_warshall_tile; ++i)
+            {
+                double * cells = distances + i * stride + column;
+                size_t * hops = next_hops + i * stride + column;
+                double to_through = distances[i * stride + k];
+                size_t hop = next_hops[i * stride + k];
+
+#pragma GCC ivdep
+                for(size_t j = 0; j < floyd_warshall_tile; ++j)
+                {
+                    double candidate = to_through + through_row[j];
+                    bool shorter = candidate < cells[j];
+
+                    cells[j] = shorter ? candidate : cells[j];
+                    hops[j] = shorter ? hop : hops[j];
+                }
+            }
+        }
+    }
+
+    // Calls function for each index in [0, count) with many threads taking indices one by one.
+    template <typename Function>
+    void parallel_tiles(size_t count, size_t threads_count, Function && function)
+    {
+        threads_count = std::min(threads_count, count);
+
+        if(threads_count <= 1)
+        {
+            for(size_t i = 0; i < count; ++i)
+                function(i);
+
+            return;
+        }
+
+        std::atomic<size_t> next_index(0);
+        std::vector<std::thread> threads;
+        auto work = [&]()
+        {
+            for(size_t i = next_index++; i < count; i = next_index++)
+                function(i);
+        };
+
+        for(size_t i = 1; i < threads_count; ++i)
+            threads.emplace_back(work);
+
+        work();
+
+        for(auto && thread : threads)
+            thread.join();
+    }
+
+    // Runs Floyd-Warshall algorithm over tiles: for each tile of intermediate vertices, relaxes
+    // its diagonal tile, then tiles in its row and column, then all remaining tiles. Tiles in each
+    // of the last two phases are independent, so they are relaxed in parallel.
+    template <typename VertexId>
+    void floyd_warshall_tiles(matrix_state<VertexId> & state, size_t threads_count)
+    {
+        size_t tiles = state.stride / floyd_warshall_tile;
+        double * distances = state.distances.data();
+        size_t * next_hops = state.next_hops.empty() ? nullptr : state.next_hops.data();
+        auto relax = [&](size_t row_tile, size_t column_tile, size_t through_tile)
+        {
+            if(next_hops == nullptr)
+                relax_tile(distances, state.stride, row_tile * floyd_warshall_tile,
+                        column_tile * floyd_warshall_tile, through_tile * floyd_warshall_tile);
+            else
+                relax_tile(distances, next_hops, state.stride, row_tile * floyd_warshall_tile,
+                        column_tile * floyd_warshall_tile, through_tile * floyd_warshall_tile);
+        };
+
+        for(size_t t = 0; t < tiles; ++t)
+        {
+            relax(t, t, t);
+            parallel_tiles(2 * (tiles - 1), threads_count,
+                    [&](size_t i)
+                    {
+                        size_t other = i / 2 < t ? i / 2 : i / 2 + 1;
+
+                        if(i % 2 == 0)
+                            relax(t, other, t);
+                        else
+                            relax(other, t, t);
+                    });
+            parallel_tiles((tiles - 1) * (tiles - 1), threads_count,
+                    [&](size_t i)
+                    {
+                        size_t row = i / (tiles - 1), column = i % (tiles - 1);
+
+                        relax(row < t ? row : row + 1, column < t ? column : column + 1, t);
+                    });
+        }
+    }
 }
 
 namespace algolib::graphs
 {
+    /*!
+     * \brief Error of a cycle with negative weight found while searching for shortest paths.
+     * \tparam Vertex the type of vertices
+     */
+    template <typename Vertex>
+    class negative_cycle_error : public std::logic_error
+    {
+    public:
+        explicit negative_cycle_error(std::vector<Vertex> cycle)
+            : std::logic_error("Graph contains a negative cycle"), cycle_{std::move(cycle)}
+        {
+        }
+
+        /*!
+         * \return the vertices on the cycle in order of its edges, with the edge from the last
+         * vertex to the first one closing the cycle
+         */
+        const std::vector<Vertex> & cycle() const
+        {
+            return this->cycle_;
+        }
+
+    private:
+        std::vector<Vertex> cycle_;
+    };
+
+    /*!
+     * \brief Shortest paths from single source vertex to vertices reached by the search.
+     */
+    template <typename VertexId, typename Weight>
+    class shortest_paths_tree
+    {
+    public:
+        using vertex_type = vertex<VertexId>;
+        using weight_type = Weight;
+
+        explicit shortest_paths_tree(internal::paths_state<VertexId, Weight> state)
+            : state{std::move(state)}
+        {
+        }
+
+        ~shortest_paths_tree() = default;
+        shortest_paths_tree(const shortest_paths_tree &) = default;
+        shortest_paths_tree(shortest_paths_tree &&) = default;
+        shortest_paths_tree & operator=(const shortest_paths_tree &) = default;
+        shortest_paths_tree & operator=(shortest_paths_tree &&) = default;
+
+        const vertex_type & source() const
+        {
+            return this->state.vertices.front();
+        }
+
+        /*!
+         * \brief Checks whether given vertex has a path from the source.
+         * \param vertex the vertex
+         * \return \c true if the vertex is reachable, otherwise \c false
+         */
+        bool reached(const vertex_type & vertex) const
+        {
+            return this->state.slots.contains(vertex);
+        }
+
+        /*!
+         * \param vertex the vertex
+         * \return the length of shortest path to the vertex, or infinity if it is not reachable
+         */
+        weight_type distance(const vertex_type & vertex) const
+        {
+            const size_t * slot = this->state.slots.find(vertex);
+
+            return slot == nullptr ? weighted::infinity : this->state.distances[*slot];
+        }
+
+        /*!
+         * \param vertex the vertex
+         * \return the previous vertex on shortest path to the vertex, or nothing for the source and
+         * for vertices not reachable
+         */
+        std::optional<vertex_type> predecessor(const vertex_type & vertex) const
+        {
+            const size_t * slot = this->state.slots.find(vertex);
+
+            if(slot == nullptr
+                    || this->state.predecessors[*slot]
+                               == internal::paths_state<VertexId, Weight>::no_predecessor)
+                return std::nullopt;
+
+            return std::make_optional(this->state.vertices[this->state.predecessors[*slot]]);
+        }
+
+        /*!
+         * \param vertex the vertex
+         * \return the vertices on shortest path from the source to the vertex, or empty if the
+         * vertex is not reachable
+         */
+        std::vector<vertex_type> path(const vertex_type & vertex) const
+        {
+            const size_t * slot = this->state.slots.find(vertex);
+
+            return slot == nullptr ? std::vector<vertex_type>() : this->state.path(*slot);
+        }
+
+        /*!
+         * \return the map of distances to reachable vertices
+         */
+        std::unordered_map<vertex_type, weight_type> distances() const
+        {
+            std::unordered_map<vertex_type, weight_type> result;
+
+            for(size_t i = 0; i < this->state.vertices.size(); ++i)
+                result.emplace(this->state.vertices[i], this->state.distances[i]);
+
+            return result;
+        }
+
+    private:
+        internal::paths_state<VertexId, Weight> state;
+    };
+
     /*!
      * \brief Computes shortest paths in given directed graph from given vertex using Bellman-Ford algorithm.
      * \param graph the directed weighted graph
@@ -43,33 +804,145 @@ namespace algolib::graphs
                     typename directed_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type
                             source)
     {
-        std::unordered_map<typename directed_graph<VertexId, VertexProperty,
-                                   EdgeProperty>::vertex_type,
+        internal::vertex_map<VertexId,
                 typename directed_graph<VertexId, VertexProperty,
                         EdgeProperty>::edge_property_type::weight_type>
-                distances;
+                distances(graph);
+        std::vector<typename directed_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type>
+                vertices = graph.vertices();
 
-        for(auto && v : graph.vertices())
+        for(auto && v : vertices)
             distances.emplace(v, directed_graph<VertexId, VertexProperty,
                                          EdgeProperty>::edge_property_type::infinity);
 
         distances[source] = 0.0;
 
-        for(size_t i = 0; i < graph.vertices_count() - 1; ++i)
-            for(auto && vertex : graph.vertices())
-                for(auto && edge : graph.adjacent_edges(vertex))
-                    distances[edge.destination()] = std::min(distances[edge.destination()],
-                            distances[vertex] + graph.properties().at(edge).weight());
+        bool changed = true;
+
+        for(size_t i = 0; changed && i < graph.vertices_count() - 1; ++i)
+        {
+            changed = false;
 
-        for(auto && vertex : graph.vertices())
-            for(auto && edge : graph.adjacent_edges(vertex))
-                if(distances[vertex] < directed_graph<VertexId, VertexProperty,
-                                EdgeProperty>::edge_property_type::infinity
-                        && distances[vertex] + graph.properties().at(edge).weight()
-                                   < distances[edge.destination()])
-                    throw std::logic_error("Graph contains a negative cycle");
+            for(auto && vertex : vertices)
+                graph.for_each_weighted_edge(vertex,
+                        [&](auto && edge, double weight)
+                        {
+                            if(distances[vertex] + weight < distances[edge.destination()])
+                            {
+                                distances[edge.destination()] = distances[vertex] + weight;
+                                changed = true;
+                            }
+                        });
+        }
 
-        return distances;
+        for(auto && vertex : vertices)
+            graph.for_each_weighted_edge(vertex,
+                    [&](auto && edge, double weight)
+                    {
+                        if(distances[vertex] < directed_graph<VertexId, VertexProperty,
+                                        EdgeProperty>::edge_property_type::infinity
+                                && distances[vertex] + weight < distances[edge.destination()])
+                            throw std::logic_error("Graph contains a negative cycle");
+                    });
+
+        return distances.to_unordered_map();
+    }
+
+    /*!
+     * \brief Computes shortest paths in given directed graph from given vertex using queue-based
+     * Bellman-Ford algorithm (SPFA), which rescans only vertices with improved distances.
+     * Predecessors are searched for a negative cycle whenever a path of improvements reaches
+     * a multiple of the number of vertices in the graph in edges.
+     * \param graph the directed weighted graph
+     * \param source the source vertex
+     * \return the shortest paths to vertices reachable from the source
+     * \throw negative_cycle_error if a cycle with negative weight is reachable from the source
+     */
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    shortest_paths_tree<VertexId,
+            typename directed_graph<VertexId, VertexProperty, EdgeProperty>::edge_property_type::
+                    weight_type>
+            spfa(const directed_graph<VertexId, VertexProperty, EdgeProperty> & graph,
+                    typename directed_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type
+                            source)
+    {
+        using weight_t = typename directed_graph<VertexId, VertexProperty,
+                EdgeProperty>::edge_property_type::weight_type;
+
+        internal::paths_state<VertexId, weight_t> state(graph, source);
+        std::deque<size_t> slot_queue = {0};
+        std::vector<bool> queued = {true};
+        // numbers of edges on paths of improvements
+        std::vector<size_t> lengths = {0};
+        std::vector<size_t> cycle_marks;
+        size_t cycle_searches = 0;
+
+        while(!slot_queue.empty())
+        {
+            size_t slot = slot_queue.front();
+            weight_t distance = state.distances[slot];
+
+            slot_queue.pop_front();
+            queued[slot] = false;
+
+            internal::outgoing_edges(graph)(state, slot,
+                    [&](size_t neighbour_slot, double weight)
+                    {
+                        if(neighbour_slot == queued.size())
+                        {
+                            queued.push_back(false);
+                            lengths.push_back(0);
+                        }
+
+                        if(!(distance + weight < state.distances[neighbour_slot]))
+                            return;
+
+                        state.distances[neighbour_slot] = distance + weight;
+                        state.predecessors[neighbour_slot] = slot;
+                        lengths[neighbour_slot] = lengths[slot] + 1;
+
+                        if(lengths[neighbour_slot] % graph.vertices_count() == 0)
+                        {
+                            std::vector<vertex<VertexId>> cycle =
+                                    internal::find_predecessors_cycle(
+                                            state, neighbour_slot, cycle_marks, ++cycle_searches);
+
+                            if(!cycle.empty())
+                                throw negative_cycle_error<vertex<VertexId>>(cycle);
+                        }
+
+                        if(!queued[neighbour_slot])
+                        {
+                            queued[neighbour_slot] = true;
+                            slot_queue.push_back(neighbour_slot);
+                        }
+                    });
+        }
+
+        return shortest_paths_tree<VertexId, weight_t>(std::move(state));
+    }
+
+    /*!
+     * \brief Computes shortest paths in given graph from given vertex using Dijkstra algorithm.
+     * \param graph_ the weighted graph with non-negative weights
+     * \param source the source vertex
+     * \return the shortest paths to vertices reachable from the source
+     * \throw std::logic_error if an edge with negative weight is reachable from the source
+     */
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    shortest_paths_tree<VertexId,
+            typename directed_graph<VertexId, VertexProperty, EdgeProperty>::edge_property_type::
+                    weight_type>
+            dijkstra_paths(const graph<VertexId, VertexProperty, EdgeProperty> & graph_,
+                    typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type source)
+    {
+        using weight_t = typename directed_graph<VertexId, VertexProperty,
+                EdgeProperty>::edge_property_type::weight_type;
+
+        internal::paths_state<VertexId, weight_t> state(graph_, source);
+
+        internal::dijkstra_search(graph_, state, [](size_t) { return false; });
+        return shortest_paths_tree<VertexId, weight_t>(std::move(state));
     }
 
     /*!
@@ -77,6 +950,7 @@ namespace algolib::graphs
      * \param graph_ the weighted graph with non-negative weights
      * \param source the source vertex
      * \return the map of distances to each vertex
+     * \throw std::logic_error if an edge with negative weight is reachable from the source
      */
     template <typename VertexId, typename VertexProperty, typename EdgeProperty>
     std::unordered_map<typename directed_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type,
@@ -84,59 +958,337 @@ namespace algolib::graphs
                     weight_type>
             dijkstra(const graph<VertexId, VertexProperty, EdgeProperty> & graph_,
                     typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type source)
+    {
+        auto paths = dijkstra_paths(graph_, source);
+        std::unordered_map<
+                typename directed_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type,
+                typename directed_graph<VertexId, VertexProperty, EdgeProperty>::
+                        edge_property_type::weight_type>
+                distances;
+
+        for(auto && vertex : graph_.vertices())
+            distances.emplace(vertex, paths.distance(vertex));
+
+        return distances;
+    }
+
+    /*!
+     * \brief Computes shortest path in given graph between given vertices using Dijkstra
+     * algorithm, which stops when the target is reached.
+     * \param graph_ the weighted graph with non-negative weights
+     * \param source the source vertex
+     * \param target the target vertex
+     * \return the length of the path and the vertices on the path from the source to the target,
+     * or infinity and no vertices if the target is not reachable
+     * \throw std::logic_error if an edge with negative weight is reached before the target
+     */
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    std::pair<typename directed_graph<VertexId, VertexProperty, EdgeProperty>::edge_property_type::
+                      weight_type,
+            std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type>>
+            shortest_path(const graph<VertexId, VertexProperty, EdgeProperty> & graph_,
+                    typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type source,
+                    typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type target)
     {
         using weight_t = typename directed_graph<VertexId, VertexProperty,
                 EdgeProperty>::edge_property_type::weight_type;
-        using pair_wv = std::pair<weight_t,
-                typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type>;
 
-        std::unordered_map<typename directed_graph<VertexId, VertexProperty,
-                                   EdgeProperty>::vertex_type,
-                weight_t>
-                distances;
-        std::vector<typename directed_graph<VertexId, VertexProperty, EdgeProperty>::edge_type>
-                edges = graph_.edges();
+        internal::paths_state<VertexId, weight_t> state(graph_, source);
+        std::optional<size_t> target_slot;
 
-        if(std::any_of(edges.begin(), edges.end(),
-                   [&](auto && edge) { return graph_.properties().at(edge).weight() < 0.0; }))
-            throw std::logic_error("Graph contains an edge with negative weight");
+        internal::dijkstra_search(graph_, state,
+                [&](size_t slot)
+                {
+                    if(state.vertices[slot] == target)
+                        target_slot = std::make_optional(slot);
 
-        std::unordered_set<typename directed_graph<VertexId, VertexProperty,
-                EdgeProperty>::vertex_type>
-                visited;
-        std::priority_queue<pair_wv, std::vector<pair_wv>, internal::dijkstra_cmp<pair_wv>>
-                vertex_queue;
+                    return target_slot.has_value();
+                });
 
-        for(auto && v : graph_.vertices())
-            distances.emplace(v, directed_graph<VertexId, VertexProperty,
-                                         EdgeProperty>::edge_property_type::infinity);
+        if(!target_slot)
+            return std::make_pair(weighted::infinity, std::vector<vertex<VertexId>>());
 
-        distances[source] = 0.0;
-        vertex_queue.push(std::make_pair(0.0, source));
+        return std::make_pair(state.distances[*target_slot], state.path(*target_slot));
+    }
+
+    /*!
+     * \brief Computes shortest path in given directed graph between given vertices using
+     * bidirectional Dijkstra algorithm, which searches backwards from the target along incoming
+     * edges at the same time.
+     * \param graph the directed weighted graph with non-negative weights
+     * \param source the source vertex
+     * \param target the target vertex
+     * \return the length of the path and the vertices on the path from the source to the target,
+     * or infinity and no vertices if the target is not reachable
+     * \throw std::logic_error if an edge with negative weight is reached
+     */
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    std::pair<typename directed_graph<VertexId, VertexProperty, EdgeProperty>::edge_property_type::
+                      weight_type,
+            std::vector<
+                    typename directed_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type>>
+            bidirectional_dijkstra(
+                    const directed_graph<VertexId, VertexProperty, EdgeProperty> & graph,
+                    typename directed_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type
+                            source,
+                    typename directed_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type
+                            target)
+    {
+        using weight_t = typename directed_graph<VertexId, VertexProperty,
+                EdgeProperty>::edge_property_type::weight_type;
 
-        while(!vertex_queue.empty())
+        return internal::bidirectional_search<VertexId, VertexProperty, EdgeProperty, weight_t>(
+                graph, source, target, internal::incoming_edges(graph));
+    }
+
+    /*!
+     * \brief Computes shortest path in given undirected graph between given vertices using
+     * bidirectional Dijkstra algorithm, which searches from the target at the same time.
+     * \param graph the undirected weighted graph with non-negative weights
+     * \param source the source vertex
+     * \param target the target vertex
+     * \return the length of the path and the vertices on the path from the source to the target,
+     * or infinity and no vertices if the target is not reachable
+     * \throw std::logic_error if an edge with negative weight is reached
+     */
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    std::pair<typename undirected_graph<VertexId, VertexProperty, EdgeProperty>::
+                      edge_property_type::weight_type,
+            std::vector<
+                    typename undirected_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type>>
+            bidirectional_dijkstra(
+                    const undirected_graph<VertexId, VertexProperty, EdgeProperty> & graph,
+                    typename undirected_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type
+                            source,
+                    typename undirected_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type
+                            target)
+    {
+        using weight_t = typename undirected_graph<VertexId, VertexProperty,
+                EdgeProperty>::edge_property_type::weight_type;
+
+        return internal::bidirectional_search<VertexId, VertexProperty, EdgeProperty, weight_t>(
+                graph, source, target, internal::outgoing_edges(graph));
+    }
+
+    /*!
+     * \brief Computes shortest path in given graph between given vertices using A* algorithm,
+     * which searches vertices in order of distance from the source plus estimated distance to the
+     * target.
+     * \param graph_ the weighted graph with non-negative weights
+     * \param source the source vertex
+     * \param target the target vertex
+     * \param heuristic the function of vertex and target that estimates the distance between them
+     * without exceeding it
+     * \return the length of the path and the vertices on the path from the source to the target,
+     * or infinity and no vertices if the target is not reachable
+     * \throw std::logic_error if an edge with negative weight is reached before the target
+     */
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty, typename Heuristic>
+    std::pair<typename directed_graph<VertexId, VertexProperty, EdgeProperty>::edge_property_type::
+                      weight_type,
+            std::vector<typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type>>
+            a_star(const graph<VertexId, VertexProperty, EdgeProperty> & graph_,
+                    typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type source,
+                    typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type target,
+                    Heuristic && heuristic)
+    {
+        using weight_t = typename directed_graph<VertexId, VertexProperty,
+                EdgeProperty>::edge_property_type::weight_type;
+
+        internal::paths_state<VertexId, weight_t> state(graph_, source);
+        internal::indexed_heap<weight_t> heap;
+        // estimated distances to the target, computed once per reached vertex
+        std::vector<weight_t> estimates;
+        auto priority = [&](size_t slot, weight_t distance)
         {
-            auto vertex = vertex_queue.top().second;
+            for(size_t i = estimates.size(); i <= slot; ++i)
+                estimates.push_back(heuristic(state.vertices[i], target));
 
-            vertex_queue.pop();
+            return distance + estimates[slot];
+        };
 
-            auto insert_result = visited.insert(vertex);
+        heap.push(0, priority(0, 0.0));
 
-            if(insert_result.second)
-                for(auto && edge : graph_.adjacent_edges(vertex))
-                {
-                    auto neighbour = edge.get_neighbour(vertex);
-                    weight_t weight = graph_.properties().at(edge).weight();
+        while(!heap.empty())
+        {
+            size_t slot = heap.pop();
 
-                    if(distances[vertex] + weight < distances[neighbour])
-                    {
-                        distances[neighbour] = distances[vertex] + weight;
-                        vertex_queue.push(std::make_pair(distances[neighbour], neighbour));
-                    }
-                }
+            if(state.vertices[slot] == target)
+                return std::make_pair(state.distances[slot], state.path(slot));
+
+            internal::dijkstra_relax(state, heap, slot, internal::outgoing_edges(graph_), priority,
+                    [](size_t, weight_t) {});
         }
 
-        return distances;
+        return std::make_pair(weighted::infinity, std::vector<vertex<VertexId>>());
+    }
+
+    /*!
+     * \brief Creates heuristic for A* algorithm as Euclidean distance between points, which are
+     * properties of vertices in given graph.
+     * \tparam VertexProperty the type of vertex properties, point_2d or point_3d or derived from
+     * them
+     * \param graph_ the graph
+     * \param scale the factor of distance, which keeps the heuristic within lengths of paths
+     * \return the heuristic
+     */
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    auto euclidean_heuristic(const graph<VertexId, VertexProperty, EdgeProperty> & graph_,
+            double scale = 1.0)
+    {
+        return [&graph_, scale](const vertex<VertexId> & source, const vertex<VertexId> & target)
+        {
+            return scale
+                   * internal::euclidean_distance(graph_.properties().at(source),
+                           graph_.properties().at(target));
+        };
+    }
+
+    /*!
+     * \brief Creates heuristic for A* algorithm as Manhattan distance between points, which are
+     * properties of vertices in given graph.
+     * \tparam VertexProperty the type of vertex properties, point_2d or point_3d or derived from
+     * them
+     * \param graph_ the graph
+     * \param scale the factor of distance, which keeps the heuristic within lengths of paths
+     * \return the heuristic
+     */
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    auto manhattan_heuristic(const graph<VertexId, VertexProperty, EdgeProperty> & graph_,
+            double scale = 1.0)
+    {
+        return [&graph_, scale](const vertex<VertexId> & source, const vertex<VertexId> & target)
+        {
+            return scale
+                   * internal::manhattan_distance(graph_.properties().at(source),
+                           graph_.properties().at(target));
+        };
+    }
+
+    /*!
+     * \brief Shortest distances between all pairs of vertices stored in a dense matrix, with
+     * vertices mapped to consecutive indices.
+     */
+    template <typename VertexId>
+    class distance_matrix
+    {
+    public:
+        using vertex_type = vertex<VertexId>;
+
+        explicit distance_matrix(internal::matrix_state<VertexId> state) : state{std::move(state)}
+        {
+        }
+
+        ~distance_matrix() = default;
+        distance_matrix(const distance_matrix &) = default;
+        distance_matrix(distance_matrix &&) = default;
+        distance_matrix & operator=(const distance_matrix &) = default;
+        distance_matrix & operator=(distance_matrix &&) = default;
+
+        /*!
+         * \return the vertices in order of their indices
+         */
+        const std::vector<vertex_type> & vertices() const
+        {
+            return this->state.vertices;
+        }
+
+        /*!
+         * \param vertex the vertex
+         * \return the index of the vertex in the matrix
+         * \throw std::out_of_range if the vertex does not belong to the graph
+         */
+        size_t index(const vertex_type & vertex) const
+        {
+            const size_t * index = this->state.indices.find(vertex);
+
+            if(index == nullptr)
+                throw std::out_of_range("Vertex not found");
+
+            return *index;
+        }
+
+        /*!
+         * \param source_index the index of the source vertex
+         * \param destination_index the index of the destination vertex
+         * \return the length of shortest path, or infinity if there is no path
+         */
+        double distance(size_t source_index, size_t destination_index) const
+        {
+            return this->state.distances[source_index * this->state.stride + destination_index];
+        }
+
+        /*!
+         * \param source the source vertex
+         * \param destination the destination vertex
+         * \return the length of shortest path, or infinity if there is no path
+         * \throw std::out_of_range if any vertex does not belong to the graph
+         */
+        double distance(const vertex_type & source, const vertex_type & destination) const
+        {
+            return this->distance(this->index(source), this->index(destination));
+        }
+
+        /*!
+         * \return \c true if next hops for paths have been computed, otherwise \c false
+         */
+        bool has_paths() const
+        {
+            return !this->state.next_hops.empty();
+        }
+
+        /*!
+         * \brief Gets the vertices on shortest path by following next hops.
+         * \param source the source vertex
+         * \param destination the destination vertex
+         * \return the vertices on shortest path, or empty if there is no path
+         * \throw std::logic_error if next hops have not been computed
+         */
+        std::vector<vertex_type> path(const vertex_type & source,
+                const vertex_type & destination) const
+        {
+            if(!this->has_paths())
+                throw std::logic_error("Paths have not been computed");
+
+            size_t index = this->index(source), destination_index = this->index(destination);
+            std::vector<vertex_type> result;
+
+            if(this->distance(index, destination_index) == weighted::infinity)
+                return result;
+
+            result.push_back(source);
+
+            while(index != destination_index)
+            {
+                index = this->state.next_hops[index * this->state.stride + destination_index];
+                result.push_back(this->state.vertices[index]);
+            }
+
+            return result;
+        }
+
+    private:
+        internal::matrix_state<VertexId> state;
+    };
+
+    /*!
+     * \brief Computes shortest paths in given directed graph between all vertices using
+     * Floyd-Warshall algorithm on a dense matrix relaxed in tiles by many threads.
+     * \param graph the directed weighted graph without negative cycles
+     * \param with_paths whether to compute next hops for paths
+     * \param threads_count the number of threads relaxing tiles
+     * \return the matrix of distances between each pair of vertices
+     */
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    distance_matrix<VertexId> floyd_warshall_matrix(
+            const directed_graph<VertexId, VertexProperty, EdgeProperty> & graph,
+            bool with_paths = false,
+            size_t threads_count = std::thread::hardware_concurrency())
+    {
+        internal::matrix_state<VertexId> state(graph, with_paths);
+
+        internal::floyd_warshall_tiles(state, std::max<size_t>(threads_count, 1));
+        return distance_matrix<VertexId>(std::move(state));
     }
 
     /*!
@@ -151,29 +1303,15 @@ namespace algolib::graphs
             double
     > floyd_warshall(const directed_graph<VertexId, VertexProperty, EdgeProperty> & graph)
     {
-        std::unordered_map<std::pair<typename directed_graph<VertexId, VertexProperty,
-                                             EdgeProperty>::vertex_type,
-                                   typename directed_graph<VertexId, VertexProperty,
-                                           EdgeProperty>::vertex_type>,
-                double>
-                distances;
-
-        for(auto && v : graph.vertices())
-            for(auto && u : graph.vertices())
-                distances.emplace(std::make_pair(v, u),
-                        v == u ? 0.0
-                               : directed_graph<VertexId, VertexProperty,
-                                         EdgeProperty>::edge_property_type::infinity);
+        distance_matrix<VertexId> matrix = floyd_warshall_matrix(graph);
+        const std::vector<vertex<VertexId>> & vertices = matrix.vertices();
+        std::unordered_map<std::pair<vertex<VertexId>, vertex<VertexId>>, double> distances;
 
-        for(auto && edge : graph.edges())
-            distances[std::make_pair(edge.source(), edge.destination())] =
-                    graph.properties().at(edge).weight();
+        distances.reserve(vertices.size() * vertices.size());
 
-        for(auto && w : graph.vertices())
-            for(auto && v : graph.vertices())
-                for(auto && u : graph.vertices())
-                    distances[std::make_pair(v, u)] = std::min(distances[std::make_pair(v, u)],
-                            distances[std::make_pair(v, w)] + distances[std::make_pair(w, u)]);
+        for(size_t i = 0; i < vertices.size(); ++i)
+            for(size_t j = 0; j < vertices.size(); ++j)
+                distances.emplace(std::make_pair(vertices[i], vertices[j]), matrix.distance(i, j));
 
         return distances;
     }
@@ -6,11 +6,14 @@
 #define STRONGLY_CONNECTED_COMPONENTS_HPP_
 
 #include <algorithm>
-#include <unordered_map>
+#include <optional>
+#include <stack>
 #include <unordered_set>
 #include <vector>
 #include "algolib/graphs/algorithms/searching.hpp"
+#include "algolib/graphs/algorithms/vertex_map.hpp"
 #include "algolib/graphs/directed_graph.hpp"
+#include "algolib/graphs/flat_hash.hpp"
 
 namespace internal
 {
@@ -19,69 +22,22 @@ namespace internal
 #pragma region post_order_strategy
 
     template <typename Vertex>
-    struct post_order_strategy : public algr::dfs_strategy<Vertex>
+    struct post_order_strategy : public algr::static_strategy<Vertex>
     {
         post_order_strategy() : timer{0}
         {
         }
 
-        void for_root(const Vertex &) override
-        {
-        }
-
-        void on_entry(const Vertex &) override
-        {
-        }
-
-        void on_next_vertex(const Vertex &, const Vertex &) override
-        {
-        }
-
-        void on_exit(const Vertex & vertex) override
+        void on_exit(const Vertex & vertex)
         {
             this->post_times.emplace(vertex, timer);
             ++this->timer;
         }
 
-        void on_edge_to_visited(const Vertex &, const Vertex &) override
-        {
-        }
-
-        std::unordered_map<Vertex, int> post_times;
+        flat_hash_map<Vertex, int> post_times;
         int timer;
     };
 
-#pragma endregion
-#pragma region scc_strategy
-
-    template <typename Vertex>
-    struct scc_strategy : public algr::dfs_strategy<Vertex>
-    {
-        void for_root(const Vertex &) override
-        {
-            this->components.push_back(std::unordered_set<Vertex>());
-        }
-
-        void on_entry(const Vertex & vertex) override
-        {
-            this->components.back().insert(vertex);
-        }
-
-        void on_next_vertex(const Vertex &, const Vertex &) override
-        {
-        }
-
-        void on_exit(const Vertex &) override
-        {
-        }
-
-        void on_edge_to_visited(const Vertex &, const Vertex &) override
-        {
-        }
-
-        std::vector<std::unordered_set<Vertex>> components;
-    };
-
 #pragma endregion
 }
 
@@ -95,36 +51,77 @@ namespace algolib::graphs
     template <typename VertexId, typename VertexProperty, typename EdgeProperty>
     std::vector<std::unordered_set<typename directed_graph<VertexId, VertexProperty, EdgeProperty>::
                     vertex_type>>
-            find_scc(const directed_simple_graph<VertexId, VertexProperty, EdgeProperty> & graph)
+            find_scc(const directed_graph<VertexId, VertexProperty, EdgeProperty> & graph)
     {
-        internal::post_order_strategy<typename directed_graph<VertexId, VertexProperty,
-                EdgeProperty>::vertex_type>
-                post_order_strategy;
+        using vertex_type = typename directed_graph<VertexId, VertexProperty,
+                EdgeProperty>::vertex_type;
+
+        internal::post_order_strategy<vertex_type> post_order_strategy;
 
         dfs_recursive(graph, post_order_strategy, graph.vertices());
 
-        std::vector<std::pair<
-                typename directed_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type, int
-        >>
-                entries;
-        std::vector<typename directed_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type>
-                vertices;
+        std::vector<std::pair<vertex_type, int>> entries;
+        std::vector<std::unordered_set<vertex_type>> components;
+        internal::vertex_map<VertexId, bool> assigned(graph);
 
         std::copy(post_order_strategy.post_times.begin(), post_order_strategy.post_times.end(),
                 std::back_inserter(entries));
         std::sort(entries.begin(), entries.end(),
                 [](auto && entry1, auto && entry2) { return entry2.second < entry1.second; });
-        std::transform(entries.begin(), entries.end(), std::back_inserter(vertices),
-                [](auto && entry) { return entry.first; });
 
-        directed_simple_graph<VertexId, VertexProperty, EdgeProperty> reversed_graph =
-                graph.reversed_copy();
-        internal::scc_strategy<typename directed_graph<VertexId, VertexProperty,
-                EdgeProperty>::vertex_type>
-                scc_strategy;
+        // components are flooded along predecessors; graphs without index of incoming edges find
+        // them by a scan, so they are collected in one pass instead of queried for each vertex
+        std::optional<internal::vertex_map<VertexId, std::vector<vertex_type>>> predecessors;
+
+        if(!graph.indexes_incoming())
+        {
+            predecessors.emplace(graph);
+
+            for(auto && vertex : graph.vertices())
+                graph.for_each_neighbour(vertex,
+                        [&](auto && neighbour) { (*predecessors)[neighbour].push_back(vertex); });
+        }
+
+        for(auto && entry : entries)
+        {
+            if(assigned.contains(entry.first))
+                continue;
+
+            std::unordered_set<vertex_type> component;
+            std::stack<vertex_type> vertex_stack;
+            auto visit = [&](const vertex_type & predecessor)
+            {
+                if(assigned.emplace(predecessor, true))
+                    vertex_stack.push(predecessor);
+            };
+
+            visit(entry.first);
+
+            while(!vertex_stack.empty())
+            {
+                vertex_type vertex = vertex_stack.top();
+
+                vertex_stack.pop();
+                component.insert(vertex);
+
+                if(!predecessors)
+                {
+                    graph.for_each_incoming_edge(
+                            vertex, [&](auto && edge) { visit(edge.source()); });
+                    continue;
+                }
+
+                std::vector<vertex_type> * vertex_predecessors = predecessors->find(vertex);
+
+                if(vertex_predecessors != nullptr)
+                    for(auto && predecessor : *vertex_predecessors)
+                        visit(predecessor);
+            }
+
+            components.push_back(component);
+        }
 
-        dfs_recursive(reversed_graph, scc_strategy, vertices);
-        return scc_strategy.components;
+        return components;
     }
 }
 
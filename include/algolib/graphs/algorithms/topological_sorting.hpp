@@ -9,10 +9,10 @@
 #include <queue>
 #include <stdexcept>
 #include <string>
-#include <unordered_map>
 #include <vector>
 #include "algolib/graphs/algorithms/searching.hpp"
 #include "algolib/graphs/directed_graph.hpp"
+#include "algolib/graphs/flat_hash.hpp"
 
 using namespace std::string_literals;
 
@@ -33,29 +33,15 @@ namespace internal
     namespace algr = algolib::graphs;
 
     template <typename Vertex>
-    class topological_strategy : public algr::dfs_strategy<Vertex>
+    class topological_strategy : public algr::static_strategy<Vertex>
     {
     public:
-        ~topological_strategy() override = default;
-
-        void for_root(const Vertex &) override
-        {
-        }
-
-        void on_entry(const Vertex &) override
-        {
-        }
-
-        void on_next_vertex(const Vertex &, const Vertex &) override
-        {
-        }
-
-        void on_exit(const Vertex & vertex) override
+        void on_exit(const Vertex & vertex)
         {
             order.push_back(vertex);
         }
 
-        void on_edge_to_visited(const Vertex &, const Vertex &) override
+        void on_edge_to_visited(const Vertex &, const Vertex &)
         {
             throw algr::directed_cyclic_graph_error("Given graph contains a cycle"s);
         }
@@ -83,7 +69,7 @@ namespace algolib::graphs
         if(graph.edges_count() == 0)
             return graph.vertices();
 
-        std::unordered_map<
+        internal::flat_hash_map<
                 typename directed_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type, int
         >
                 input_degrees;
@@ -95,15 +81,16 @@ namespace algolib::graphs
                         EdgeProperty>::vertex_type>>
                 vertex_queue;
 
+        // input degrees are counted in one pass, as graphs may find them by scanning all edges
         for(auto && vertex : graph.vertices())
-        {
-            int degree = graph.input_degree(vertex);
+            input_degrees.emplace(vertex, 0);
 
-            input_degrees.emplace(vertex, degree);
+        for(auto && vertex : graph.vertices())
+            graph.for_each_neighbour(vertex, [&](auto && neighbour) { ++input_degrees[neighbour]; });
 
-            if(degree == 0)
+        for(auto && vertex : graph.vertices())
+            if(input_degrees[vertex] == 0)
                 vertex_queue.push(vertex);
-        }
 
         while(!vertex_queue.empty())
         {
@@ -113,13 +100,14 @@ namespace algolib::graphs
             order.push_back(vertex);
             input_degrees.erase(vertex);
 
-            for(auto && neighbour : graph.neighbours(vertex))
-            {
-                --input_degrees[neighbour];
+            graph.for_each_neighbour(vertex,
+                    [&](auto && neighbour)
+                    {
+                        --input_degrees[neighbour];
 
-                if(input_degrees[neighbour] == 0)
-                    vertex_queue.push(neighbour);
-            }
+                        if(input_degrees[neighbour] == 0)
+                            vertex_queue.push(neighbour);
+                    });
         }
 
         if(order.size() != graph.vertices_count())
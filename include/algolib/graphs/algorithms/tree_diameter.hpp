@@ -7,43 +7,10 @@
 
 #include <cmath>
 #include <algorithm>
+#include <memory>
 #include <vector>
 #include "algolib/graphs/tree_graph.hpp"
 
-namespace internal
-{
-    namespace algr = algolib::graphs;
-
-    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
-    std::pair<double, double> dfs(
-            const algr::tree_graph<VertexId, VertexProperty, EdgeProperty> & tree,
-            const typename algr::tree_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type &
-                    vertex,
-            const typename algr::tree_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type &
-                    parent)
-    {
-        double path_from = 0.0, path_subtree = 0.0, path_through = 0.0;
-
-        for(auto && edge : tree.adjacent_edges(vertex))
-        {
-            typename algr::tree_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type
-                    neighbour = edge.get_neighbour(vertex);
-
-            if(neighbour != parent)
-            {
-                double weight = tree.properties().at(edge).weight();
-                std::pair<double, double> result = dfs(tree, neighbour, vertex);
-
-                path_through = std::max(path_through, path_from + result.first + weight);
-                path_subtree = std::max(path_subtree, result.second);
-                path_from = std::max(path_from, result.first + weight);
-            }
-        }
-
-        return std::make_pair(path_from, std::max(path_through, path_subtree));
-    }
-}
-
 namespace algolib::graphs
 {
     /*!
@@ -60,7 +27,29 @@ namespace algolib::graphs
                 std::max_element(vertices.begin(), vertices.end(), [&](auto && v1, auto && v2)
                         { return tree.output_degree(v1) < tree.output_degree(v2); });
 
-        return root_it == vertices.end() ? 0.0 : internal::dfs(tree, *root_it, *root_it).second;
+        if(root_it == vertices.end())
+            return 0.0;
+
+        std::shared_ptr<const rooted_tree<VertexId>> rooted = tree.rooted(*root_it);
+        const std::vector<size_t> & parents = rooted->parents();
+        // longest path down from vertex and longest path within its subtree
+        std::vector<double> paths_from(rooted->size(), 0.0);
+        std::vector<double> paths_within(rooted->size(), 0.0);
+
+        // children come after their parents in pre-order, so they are done first in reverse
+        for(size_t i = rooted->size() - 1; i > 0; --i)
+        {
+            size_t parent = parents[i];
+            double weight = tree.properties().at(rooted->parent_edge(i)).weight();
+            double path = paths_from[i] + weight;
+
+            paths_within[i] = std::max(paths_within[i], paths_from[i]);
+            paths_within[parent] =
+                    std::max({paths_within[parent], paths_within[i], paths_from[parent] + path});
+            paths_from[parent] = std::max(paths_from[parent], path);
+        }
+
+        return std::max(paths_within[0], paths_from[0]);
     }
 }
 
@@ -0,0 +1,172 @@
+/**!
+ * \file vertex_map.hpp
+ * \brief Per-vertex state of graph algorithms.
+ */
+#ifndef VERTEX_MAP_HPP_
+#define VERTEX_MAP_HPP_
+
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include "algolib/graphs/flat_hash.hpp"
+#include "algolib/graphs/graph.hpp"
+
+namespace internal
+{
+    namespace algr = algolib::graphs;
+
+    // Map from vertices to values, kept in a flat vector when the graph is dense and in a flat
+    // hash table otherwise.
+    template <typename VertexId, typename Value>
+    class vertex_map
+    {
+    public:
+        using vertex_type = algr::vertex<VertexId>;
+
+        template <typename VertexProperty, typename EdgeProperty>
+        explicit vertex_map(const algr::graph<VertexId, VertexProperty, EdgeProperty> & graph)
+            : dense{std::is_integral_v<VertexId> && graph.is_dense()}
+        {
+            if(this->dense)
+                this->dense_values.resize(graph.vertices_count());
+        }
+
+        ~vertex_map() = default;
+        vertex_map(const vertex_map &) = default;
+        vertex_map(vertex_map &&) = default;
+        vertex_map & operator=(const vertex_map &) = default;
+        vertex_map & operator=(vertex_map &&) = default;
+
+        Value * find(const vertex_type & vertex)
+        {
+            if(this->dense)
+            {
+                std::optional<Value> & value = this->dense_values[index(vertex)];
+
+                return value ? &*value : nullptr;
+            }
+
+            auto it = this->sparse_values.find(vertex);
+
+            return it == this->sparse_values.end() ? nullptr : &it->second;
+        }
+
+        const Value * find(const vertex_type & vertex) const
+        {
+            return const_cast<vertex_map *>(this)->find(vertex);
+        }
+
+        bool contains(const vertex_type & vertex) const
+        {
+            return this->find(vertex) != nullptr;
+        }
+
+        Value & operator[](const vertex_type & vertex)
+        {
+            if(this->dense)
+            {
+                std::optional<Value> & value = this->dense_values[index(vertex)];
+
+                if(!value)
+                    value.emplace();
+
+                return *value;
+            }
+
+            return this->sparse_values[vertex];
+        }
+
+        bool emplace(const vertex_type & vertex, const Value & value)
+        {
+            if(this->dense)
+            {
+                std::optional<Value> & entry = this->dense_values[index(vertex)];
+
+                if(entry)
+                    return false;
+
+                entry.emplace(value);
+                return true;
+            }
+
+            return this->sparse_values.emplace(vertex, value).second;
+        }
+
+        void erase(const vertex_type & vertex)
+        {
+            if(this->dense)
+                this->dense_values[index(vertex)].reset();
+            else
+                this->sparse_values.erase(vertex);
+        }
+
+        std::vector<vertex_type> keys() const
+        {
+            std::vector<vertex_type> result;
+
+            if constexpr(std::is_integral_v<VertexId>)
+            {
+                if(this->dense)
+                {
+                    for(size_t i = 0; i < this->dense_values.size(); ++i)
+                        if(this->dense_values[i])
+                            result.push_back(vertex_type(static_cast<VertexId>(i)));
+
+                    return result;
+                }
+            }
+
+            for(auto && entry : this->sparse_values)
+                result.push_back(entry.first);
+
+            return result;
+        }
+
+        std::unordered_map<vertex_type, Value> to_unordered_map() const
+        {
+            if constexpr(std::is_integral_v<VertexId>)
+            {
+                if(this->dense)
+                {
+                    std::unordered_map<vertex_type, Value> result;
+
+                    result.reserve(this->dense_values.size());
+
+                    for(size_t i = 0; i < this->dense_values.size(); ++i)
+                        if(this->dense_values[i])
+                            result.emplace(vertex_type(static_cast<VertexId>(i)),
+                                    *this->dense_values[i]);
+
+                    return result;
+                }
+            }
+
+            return std::unordered_map<vertex_type, Value>(
+                    this->sparse_values.begin(), this->sparse_values.end());
+        }
+
+    private:
+        // Unlike the hash table, the vector cannot hold any other vertex, so one out of range
+        // of the graph is rejected as the graph itself would do.
+        size_t index(const vertex_type & vertex) const
+        {
+            size_t result = 0;
+
+            if constexpr(std::is_integral_v<VertexId>)
+                result = static_cast<size_t>(vertex.id());
+
+            if(result >= this->dense_values.size())
+                throw std::invalid_argument("Vertex does not belong to the graph");
+
+            return result;
+        }
+
+        bool dense;
+        std::vector<std::optional<Value>> dense_values;
+        flat_hash_map<vertex_type, Value> sparse_values;
+    };
+}
+
+#endif
@@ -0,0 +1,101 @@
+/*!
+ * \file concurrent_graph.hpp
+ * \brief Structure of graph shared by concurrent readers and writers.
+ */
+#ifndef CONCURRENT_GRAPH_HPP_
+#define CONCURRENT_GRAPH_HPP_
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace algolib::graphs
+{
+    /*!
+     * \brief Graph read by many threads and updated by writers in read-copy-update manner.
+     * Readers take immutable versions of the graph without locking and keep them as long as
+     * they need. Writers are serialised; each update modifies a copy of the current version and
+     * publishes it at once, so readers see either all or none of its modifications. With simple
+     * graphs copies share structure, so an update copies only the vertices it modifies and
+     * pointers to the other ones.
+     * \tparam Graph the type of graph, copies of which are cheap
+     */
+    template <typename Graph>
+    class concurrent_graph
+    {
+    public:
+        using graph_type = Graph;
+
+        /*!
+         * \param graph the initial version of the graph
+         */
+        explicit concurrent_graph(graph_type graph = graph_type())
+            : current{std::make_shared<const graph_type>(std::move(graph))}
+        {
+        }
+
+        ~concurrent_graph() = default;
+        concurrent_graph(const concurrent_graph &) = delete;
+        concurrent_graph(concurrent_graph &&) = delete;
+        concurrent_graph & operator=(const concurrent_graph &) = delete;
+        concurrent_graph & operator=(concurrent_graph &&) = delete;
+
+        /*!
+         * \brief Gets the current version of the graph.
+         * The version stays unchanged and alive while the pointer is kept.
+         * \return the pointer to the current version
+         */
+        std::shared_ptr<const graph_type> snapshot() const
+        {
+            return std::atomic_load(&this->current);
+        }
+
+        /*!
+         * \brief Calls given function on the current version of the graph.
+         * \param function the function to call
+         * \return the result of the function
+         */
+        template <typename Function>
+        auto read(Function && function) const
+        {
+            std::shared_ptr<const graph_type> graph = this->snapshot();
+
+            return std::invoke(std::forward<Function>(function), *graph);
+        }
+
+        /*!
+         * \brief Modifies the graph with given function and publishes the result as a new version.
+         * If the function throws an exception, no new version is published.
+         * \param function the function modifying the graph
+         * \return the result of the function
+         */
+        template <typename Function>
+        auto update(Function && function)
+        {
+            std::lock_guard<std::mutex> lock(this->writer_mutex);
+            std::shared_ptr<graph_type> graph =
+                    std::make_shared<graph_type>(*std::atomic_load(&this->current));
+
+            if constexpr(std::is_void_v<std::invoke_result_t<Function, graph_type &>>)
+            {
+                std::invoke(std::forward<Function>(function), *graph);
+                std::atomic_store(&this->current, std::shared_ptr<const graph_type>(graph));
+            }
+            else
+            {
+                auto result = std::invoke(std::forward<Function>(function), *graph);
+
+                std::atomic_store(&this->current, std::shared_ptr<const graph_type>(graph));
+                return result;
+            }
+        }
+
+    private:
+        std::shared_ptr<const graph_type> current;
+        std::mutex writer_mutex;
+    };
+}
+
+#endif
@@ -0,0 +1,745 @@
+/*!
+ * \file dense_graph.hpp
+ * \brief Structure of graph with vertices numbered consecutively from zero.
+ */
+#ifndef DENSE_GRAPH_HPP_
+#define DENSE_GRAPH_HPP_
+
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#include "algolib/graphs/directed_graph.hpp"
+#include "algolib/graphs/graph.hpp"
+#include "algolib/graphs/undirected_graph.hpp"
+
+namespace internal
+{
+    namespace algr = algolib::graphs;
+
+    template <typename Vertex, typename Edge, typename VertexProperty, typename EdgeProperty>
+    class dense_representation
+    {
+    public:
+        using vertex_type = Vertex;
+        using edge_type = Edge;
+        using vertex_property_type = VertexProperty;
+        using edge_property_type = EdgeProperty;
+
+        explicit dense_representation(size_t vertices_count = 0)
+        {
+            for(size_t i = 0; i < vertices_count; ++i)
+                this->add_vertex();
+        }
+
+        ~dense_representation() = default;
+        dense_representation(const dense_representation &) = default;
+        dense_representation(dense_representation &&) = default;
+        dense_representation & operator=(const dense_representation &) = default;
+        dense_representation & operator=(dense_representation &&) = default;
+
+        size_t size() const
+        {
+            return this->vertices_.size();
+        }
+
+        const std::vector<vertex_type> & vertices() const
+        {
+            return this->vertices_;
+        }
+
+        const std::vector<edge_type> & adjacent_edges(const vertex_type & vertex) const
+        {
+            this->validate(vertex);
+            return this->rows[vertex.id()];
+        }
+
+        const std::vector<edge_type> & incoming_edges(const vertex_type & vertex) const
+        {
+            this->validate(vertex);
+            return this->incoming_rows[vertex.id()];
+        }
+
+        const vertex_type & operator[](size_t vertex_id) const;
+        const edge_type & operator[](const std::pair<size_t, size_t> & vertex_ids) const;
+
+        const edge_type * find_edge(size_t source_id, size_t destination_id) const;
+        vertex_property_type & property(const vertex_type & vertex);
+        vertex_property_type & property_at(const vertex_type & vertex);
+        const vertex_property_type & property_at(const vertex_type & vertex) const;
+        edge_property_type & property(const edge_type & edge);
+        edge_property_type & property_at(const edge_type & edge);
+        const edge_property_type & property_at(const edge_type & edge) const;
+        vertex_type add_vertex();
+        void add_edge_to_source(const edge_type & edge);
+        void add_edge_to_destination(const edge_type & edge);
+        void add_incoming_edge(const edge_type & edge);
+        dense_representation reversed() const;
+
+    private:
+        void validate(const vertex_type & vertex) const;
+        void validate(const edge_type & edge, bool existing) const;
+
+        std::vector<vertex_type> vertices_;
+        // rows are indexed with vertex identifiers
+        std::vector<std::vector<edge_type>> rows;
+        // filled only for directed graphs
+        std::vector<std::vector<edge_type>> incoming_rows;
+        std::vector<std::optional<vertex_property_type>> vertex_properties;
+        std::unordered_map<edge_type, edge_property_type> edge_properties;
+    };
+
+    template <typename Vertex, typename Edge, typename VertexProperty, typename EdgeProperty>
+    const typename dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::vertex_type &
+            dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::operator[](
+                    size_t vertex_id) const
+    {
+        if(vertex_id < this->vertices_.size())
+            return this->vertices_[vertex_id];
+
+        throw std::out_of_range("Vertex not found");
+    }
+
+    template <typename Vertex, typename Edge, typename VertexProperty, typename EdgeProperty>
+    const typename dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::edge_type &
+            dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::operator[](
+                    const std::pair<size_t, size_t> & vertex_ids) const
+    {
+        const edge_type * edge = this->find_edge(vertex_ids.first, vertex_ids.second);
+
+        if(edge != nullptr)
+            return *edge;
+
+        throw std::out_of_range("Edge not found");
+    }
+
+    template <typename Vertex, typename Edge, typename VertexProperty, typename EdgeProperty>
+    const typename dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::edge_type *
+            dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::find_edge(
+                    size_t source_id, size_t destination_id) const
+    {
+        if(source_id >= this->vertices_.size() || destination_id >= this->vertices_.size())
+            return nullptr;
+
+        const vertex_type & source = this->vertices_[source_id];
+        const std::vector<edge_type> & row = this->rows[source_id];
+        auto it = std::find_if(row.begin(), row.end(),
+                [&](auto && edge) { return edge.get_neighbour(source).id() == destination_id; });
+
+        return it == row.end() ? nullptr : &*it;
+    }
+
+    template <typename Vertex, typename Edge, typename VertexProperty, typename EdgeProperty>
+    typename dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::
+            vertex_property_type &
+            dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::property(
+                    const vertex_type & vertex)
+    {
+        this->validate(vertex);
+
+        std::optional<vertex_property_type> & property = this->vertex_properties[vertex.id()];
+
+        if(!property)
+            property.emplace();
+
+        return *property;
+    }
+
+    template <typename Vertex, typename Edge, typename VertexProperty, typename EdgeProperty>
+    typename dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::
+            vertex_property_type &
+            dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::property_at(
+                    const vertex_type & vertex)
+    {
+        this->validate(vertex);
+
+        std::optional<vertex_property_type> & property = this->vertex_properties[vertex.id()];
+
+        if(!property)
+            throw std::out_of_range("Property not found for vertex");
+
+        return *property;
+    }
+
+    template <typename Vertex, typename Edge, typename VertexProperty, typename EdgeProperty>
+    const typename dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::
+            vertex_property_type &
+            dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::property_at(
+                    const vertex_type & vertex) const
+    {
+        this->validate(vertex);
+
+        const std::optional<vertex_property_type> & property =
+                this->vertex_properties[vertex.id()];
+
+        if(!property)
+            throw std::out_of_range("Property not found for vertex");
+
+        return *property;
+    }
+
+    template <typename Vertex, typename Edge, typename VertexProperty, typename EdgeProperty>
+    typename dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::edge_property_type &
+            dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::property(
+                    const edge_type & edge)
+    {
+        auto it = this->edge_properties.find(edge);
+
+        if(it != this->edge_properties.end())
+            return it->second;
+
+        this->validate(edge, true);
+        return this->edge_properties[edge];
+    }
+
+    template <typename Vertex, typename Edge, typename VertexProperty, typename EdgeProperty>
+    typename dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::edge_property_type &
+            dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::property_at(
+                    const edge_type & edge)
+    {
+        auto it = this->edge_properties.find(edge);
+
+        if(it != this->edge_properties.end())
+            return it->second;
+
+        this->validate(edge, true);
+        throw std::out_of_range("Property not found for edge");
+    }
+
+    template <typename Vertex, typename Edge, typename VertexProperty, typename EdgeProperty>
+    const typename dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::
+            edge_property_type &
+            dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::property_at(
+                    const edge_type & edge) const
+    {
+        auto it = this->edge_properties.find(edge);
+
+        if(it != this->edge_properties.end())
+            return it->second;
+
+        this->validate(edge, true);
+        throw std::out_of_range("Property not found for edge");
+    }
+
+    template <typename Vertex, typename Edge, typename VertexProperty, typename EdgeProperty>
+    typename dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::vertex_type
+            dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::add_vertex()
+    {
+        this->vertices_.emplace_back(this->vertices_.size());
+        this->rows.emplace_back();
+        this->incoming_rows.emplace_back();
+        this->vertex_properties.emplace_back();
+        return this->vertices_.back();
+    }
+
+    template <typename Vertex, typename Edge, typename VertexProperty, typename EdgeProperty>
+    void dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::add_edge_to_source(
+            const edge_type & edge)
+    {
+        this->validate(edge, false);
+        this->rows[edge.source().id()].push_back(edge);
+    }
+
+    template <typename Vertex, typename Edge, typename VertexProperty, typename EdgeProperty>
+    void dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::add_edge_to_destination(
+            const edge_type & edge)
+    {
+        this->validate(edge, false);
+
+        // loops are stored once, in the row of their source
+        if(edge.source() != edge.destination())
+            this->rows[edge.destination().id()].push_back(edge);
+    }
+
+    template <typename Vertex, typename Edge, typename VertexProperty, typename EdgeProperty>
+    void dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::add_incoming_edge(
+            const edge_type & edge)
+    {
+        this->validate(edge, false);
+        this->incoming_rows[edge.destination().id()].push_back(edge);
+    }
+
+    template <typename Vertex, typename Edge, typename VertexProperty, typename EdgeProperty>
+    dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>
+            dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::reversed() const
+    {
+        dense_representation result;
+
+        result.vertices_ = this->vertices_;
+        result.vertex_properties = this->vertex_properties;
+        result.rows.resize(this->rows.size());
+        result.incoming_rows.resize(this->incoming_rows.size());
+
+        for(auto && row : this->rows)
+            for(auto && edge : row)
+            {
+                edge_type new_edge = edge.reversed();
+
+                result.rows[new_edge.source().id()].push_back(new_edge);
+                result.incoming_rows[new_edge.destination().id()].push_back(new_edge);
+            }
+
+        for(auto && entry : this->edge_properties)
+            result.edge_properties.emplace(entry.first.reversed(), entry.second);
+
+        return result;
+    }
+
+    template <typename Vertex, typename Edge, typename VertexProperty, typename EdgeProperty>
+    void dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::validate(
+            const vertex_type & vertex) const
+    {
+        if(vertex.id() >= this->vertices_.size())
+            throw std::invalid_argument("Vertex does not belong to the graph");
+    }
+
+    template <typename Vertex, typename Edge, typename VertexProperty, typename EdgeProperty>
+    void dense_representation<Vertex, Edge, VertexProperty, EdgeProperty>::validate(
+            const edge_type & edge,
+            bool existing) const
+    {
+        if(edge.source().id() >= this->vertices_.size()
+                || edge.destination().id() >= this->vertices_.size())
+            throw std::invalid_argument("Edge does not belong to the graph");
+
+        const std::vector<edge_type> & row = this->rows[edge.source().id()];
+
+        if(existing && std::find(row.begin(), row.end(), edge) == row.end())
+            throw std::invalid_argument("Edge does not belong to the graph");
+    }
+}
+
+namespace algolib::graphs
+{
+    template <typename VertexProperty, typename EdgeProperty>
+    class dense_graph : public virtual graph<size_t, VertexProperty, EdgeProperty>
+    {
+    public:
+        using vertex_id_type = typename graph<size_t, VertexProperty, EdgeProperty>::vertex_id_type;
+        using vertex_type = typename graph<size_t, VertexProperty, EdgeProperty>::vertex_type;
+        using edge_type = typename graph<size_t, VertexProperty, EdgeProperty>::edge_type;
+        using vertex_property_type =
+                typename graph<size_t, VertexProperty, EdgeProperty>::vertex_property_type;
+        using edge_property_type =
+                typename graph<size_t, VertexProperty, EdgeProperty>::edge_property_type;
+
+    protected:
+        using repr = internal::dense_representation<vertex_type,
+                edge_type,
+                vertex_property_type,
+                edge_property_type>;
+
+    private:
+        class graph_properties_impl;
+
+    public:
+        ~dense_graph() override = default;
+
+        dense_graph(const dense_graph & graph)
+            : representation{graph.representation}, graph_properties_{*this}
+        {
+        }
+
+        dense_graph(dense_graph && graph)
+            : representation{std::move(graph.representation)}, graph_properties_{*this}
+        {
+        }
+
+        dense_graph & operator=(const dense_graph & graph)
+        {
+            // properties keep referring to this graph
+            representation = graph.representation;
+            return *this;
+        }
+
+        dense_graph & operator=(dense_graph && graph)
+        {
+            representation = std::move(graph.representation);
+            return *this;
+        }
+
+        typename graph<size_t, VertexProperty, EdgeProperty>::graph_properties &
+                properties() override
+        {
+            return this->graph_properties_;
+        }
+
+        const typename graph<size_t, VertexProperty, EdgeProperty>::graph_properties &
+                properties() const override
+        {
+            return this->graph_properties_;
+        }
+
+        const vertex_type & operator[](const vertex_id_type & vertex_id) const override
+        {
+            return this->representation[vertex_id];
+        }
+
+        const edge_type & operator[](
+                const std::pair<vertex_id_type, vertex_id_type> & vertex_ids) const override
+        {
+            return this->representation[vertex_ids];
+        }
+
+        const edge_type & operator[](
+                const std::pair<vertex_type, vertex_type> & vertices) const override
+        {
+            return this->representation[std::make_pair(vertices.first.id(), vertices.second.id())];
+        }
+
+        size_t vertices_count() const override
+        {
+            return this->representation.size();
+        }
+
+        std::vector<vertex_type> vertices() const override
+        {
+            return this->representation.vertices();
+        }
+
+        std::vector<edge_type> adjacent_edges(const vertex_type & vertex) const override
+        {
+            return this->representation.adjacent_edges(vertex);
+        }
+
+        std::vector<vertex_type> neighbours(const vertex_type & vertex) const override;
+
+        void for_each_neighbour(const vertex_type & vertex,
+                internal::function_ref<void(const vertex_type &)> function) const override
+        {
+            for(auto && edge : this->representation.adjacent_edges(vertex))
+                function(edge.get_neighbour(vertex));
+        }
+
+        bool any_neighbour(const vertex_type & vertex,
+                internal::function_ref<bool(const vertex_type &)> function) const override
+        {
+            for(auto && edge : this->representation.adjacent_edges(vertex))
+                if(function(edge.get_neighbour(vertex)))
+                    return true;
+
+            return false;
+        }
+
+        void for_each_adjacent_edge(const vertex_type & vertex,
+                internal::function_ref<void(const edge_type &)> function) const override
+        {
+            for(auto && edge : this->representation.adjacent_edges(vertex))
+                function(edge);
+        }
+
+        size_t output_degree(const vertex_type & vertex) const override
+        {
+            return this->representation.adjacent_edges(vertex).size();
+        }
+
+        bool is_dense() const override
+        {
+            return true;
+        }
+
+        /*!
+         * \brief Adds new vertex with the next free identifier to this graph.
+         * \return the new vertex
+         */
+        vertex_type add_vertex()
+        {
+            return this->representation.add_vertex();
+        }
+
+        /*!
+         * \brief Adds new vertex with the next free identifier and given property to this graph.
+         * \param property the vertex property
+         * \return the new vertex
+         */
+        vertex_type add_vertex(const vertex_property_type & property)
+        {
+            vertex_type vertex = this->representation.add_vertex();
+
+            this->representation.property(vertex) = property;
+            return vertex;
+        }
+
+        edge_type add_edge_between(const vertex_type & source, const vertex_type & destination)
+        {
+            return this->add_edge(edge_type(source, destination));
+        }
+
+        edge_type add_edge_between(const vertex_type & source,
+                const vertex_type & destination,
+                const edge_property_type & property)
+        {
+            return this->add_edge(edge_type(source, destination), property);
+        }
+
+        virtual edge_type add_edge(const edge_type & edge) = 0;
+        virtual edge_type add_edge(const edge_type & edge, const edge_property_type & property) = 0;
+
+    protected:
+        explicit dense_graph(size_t vertices_count)
+            : representation{vertices_count}, graph_properties_{*this}
+        {
+        }
+
+        repr representation;
+
+    private:
+        graph_properties_impl graph_properties_;
+    };
+
+    template <typename VertexProperty, typename EdgeProperty>
+    std::vector<typename dense_graph<VertexProperty, EdgeProperty>::vertex_type>
+            dense_graph<VertexProperty, EdgeProperty>::neighbours(const vertex_type & vertex) const
+    {
+        const std::vector<edge_type> & adjacent = this->representation.adjacent_edges(vertex);
+        std::vector<vertex_type> result;
+
+        result.reserve(adjacent.size());
+        std::transform(adjacent.begin(), adjacent.end(), std::back_inserter(result),
+                [&](auto && edge) { return edge.get_neighbour(vertex); });
+        return result;
+    }
+
+    template <typename VertexProperty, typename EdgeProperty>
+    class dense_graph<VertexProperty, EdgeProperty>::graph_properties_impl
+        : public virtual graph<size_t, VertexProperty, EdgeProperty>::graph_properties
+    {
+    public:
+        explicit graph_properties_impl(dense_graph<VertexProperty, EdgeProperty> & graph)
+            : graph{graph}
+        {
+        }
+
+        vertex_property_type & operator[](const vertex_type & vertex) override
+        {
+            return graph.representation.property(vertex);
+        }
+
+        vertex_property_type & at(const vertex_type & vertex) override
+        {
+            return graph.representation.property_at(vertex);
+        }
+
+        const vertex_property_type & at(const vertex_type & vertex) const override
+        {
+            return graph.representation.property_at(vertex);
+        }
+
+        edge_property_type & operator[](const edge_type & edge) override
+        {
+            return graph.representation.property(edge);
+        }
+
+        edge_property_type & at(const edge_type & edge) override
+        {
+            return graph.representation.property_at(edge);
+        }
+
+        const edge_property_type & at(const edge_type & edge) const override
+        {
+            return graph.representation.property_at(edge);
+        }
+
+    private:
+        dense_graph<VertexProperty, EdgeProperty> & graph;
+    };
+
+    template <typename VertexProperty = std::nullptr_t, typename EdgeProperty = std::nullptr_t>
+    class dense_directed_graph
+        : public dense_graph<VertexProperty, EdgeProperty>,
+          public virtual directed_graph<size_t, VertexProperty, EdgeProperty>
+    {
+    public:
+        using vertex_id_type = typename dense_graph<VertexProperty, EdgeProperty>::vertex_id_type;
+        using vertex_type = typename dense_graph<VertexProperty, EdgeProperty>::vertex_type;
+        using edge_type = typename dense_graph<VertexProperty, EdgeProperty>::edge_type;
+        using vertex_property_type =
+                typename dense_graph<VertexProperty, EdgeProperty>::vertex_property_type;
+        using edge_property_type =
+                typename dense_graph<VertexProperty, EdgeProperty>::edge_property_type;
+
+        explicit dense_directed_graph(size_t vertices_count = 0)
+            : dense_graph<VertexProperty, EdgeProperty>(vertices_count)
+        {
+        }
+
+        ~dense_directed_graph() override = default;
+        dense_directed_graph(const dense_directed_graph &) = default;
+        dense_directed_graph(dense_directed_graph &&) = default;
+        dense_directed_graph & operator=(const dense_directed_graph &) = default;
+        dense_directed_graph & operator=(dense_directed_graph &&) = default;
+
+        size_t edges_count() const override
+        {
+            return this->edges_count_;
+        }
+
+        std::vector<edge_type> edges() const override;
+
+        size_t input_degree(const vertex_type & vertex) const override
+        {
+            return this->representation.incoming_edges(vertex).size();
+        }
+
+        bool indexes_incoming() const override
+        {
+            return true;
+        }
+
+        std::vector<vertex_type> predecessors(const vertex_type & vertex) const override;
+
+        std::vector<edge_type> incoming_edges(const vertex_type & vertex) const override
+        {
+            return this->representation.incoming_edges(vertex);
+        }
+
+        void for_each_incoming_edge(const vertex_type & vertex,
+                internal::function_ref<void(const edge_type &)> function) const override
+        {
+            for(auto && edge : this->representation.incoming_edges(vertex))
+                function(edge);
+        }
+
+        edge_type add_edge(const edge_type & edge) override;
+        edge_type add_edge(const edge_type & edge, const edge_property_type & property) override;
+
+        void reverse() override
+        {
+            this->representation = this->representation.reversed();
+        }
+
+    private:
+        size_t edges_count_ = 0;
+    };
+
+    template <typename VertexProperty, typename EdgeProperty>
+    std::vector<typename dense_directed_graph<VertexProperty, EdgeProperty>::edge_type>
+            dense_directed_graph<VertexProperty, EdgeProperty>::edges() const
+    {
+        std::vector<edge_type> result;
+
+        result.reserve(this->edges_count_);
+
+        for(auto && vertex : this->representation.vertices())
+        {
+            const std::vector<edge_type> & row = this->representation.adjacent_edges(vertex);
+
+            result.insert(result.end(), row.begin(), row.end());
+        }
+
+        return result;
+    }
+
+    template <typename VertexProperty, typename EdgeProperty>
+    std::vector<typename dense_directed_graph<VertexProperty, EdgeProperty>::vertex_type>
+            dense_directed_graph<VertexProperty, EdgeProperty>::predecessors(
+                    const vertex_type & vertex) const
+    {
+        const std::vector<edge_type> & incoming = this->representation.incoming_edges(vertex);
+        std::vector<vertex_type> result;
+
+        result.reserve(incoming.size());
+        std::transform(incoming.begin(), incoming.end(), std::back_inserter(result),
+                [&](auto && edge) { return edge.source(); });
+        return result;
+    }
+
+    template <typename VertexProperty, typename EdgeProperty>
+    typename dense_directed_graph<VertexProperty, EdgeProperty>::edge_type
+            dense_directed_graph<VertexProperty, EdgeProperty>::add_edge(const edge_type & edge)
+    {
+        if(this->representation.find_edge(edge.source().id(), edge.destination().id()) != nullptr)
+            throw std::invalid_argument("Edge already exists");
+
+        this->representation.add_edge_to_source(edge);
+        this->representation.add_incoming_edge(edge);
+        ++this->edges_count_;
+        return edge;
+    }
+
+    template <typename VertexProperty, typename EdgeProperty>
+    typename dense_directed_graph<VertexProperty, EdgeProperty>::edge_type
+            dense_directed_graph<VertexProperty, EdgeProperty>::add_edge(
+                    const edge_type & edge,
+                    const edge_property_type & property)
+    {
+        this->add_edge(edge);
+        this->representation.property(edge) = property;
+        return edge;
+    }
+
+    template <typename VertexProperty = std::nullptr_t, typename EdgeProperty = std::nullptr_t>
+    class dense_undirected_graph
+        : public dense_graph<VertexProperty, EdgeProperty>,
+          public virtual undirected_graph<size_t, VertexProperty, EdgeProperty>
+    {
+    public:
+        using vertex_id_type = typename dense_graph<VertexProperty, EdgeProperty>::vertex_id_type;
+        using vertex_type = typename dense_graph<VertexProperty, EdgeProperty>::vertex_type;
+        using edge_type = typename dense_graph<VertexProperty, EdgeProperty>::edge_type;
+        using vertex_property_type =
+                typename dense_graph<VertexProperty, EdgeProperty>::vertex_property_type;
+        using edge_property_type =
+                typename dense_graph<VertexProperty, EdgeProperty>::edge_property_type;
+
+        explicit dense_undirected_graph(size_t vertices_count = 0)
+            : dense_graph<VertexProperty, EdgeProperty>(vertices_count)
+        {
+        }
+
+        ~dense_undirected_graph() override = default;
+        dense_undirected_graph(const dense_undirected_graph &) = default;
+        dense_undirected_graph(dense_undirected_graph &&) = default;
+        dense_undirected_graph & operator=(const dense_undirected_graph &) = default;
+        dense_undirected_graph & operator=(dense_undirected_graph &&) = default;
+
+        size_t edges_count() const override
+        {
+            return this->edge_list.size();
+        }
+
+        std::vector<edge_type> edges() const override
+        {
+            return this->edge_list;
+        }
+
+        size_t input_degree(const vertex_type & vertex) const override
+        {
+            return this->output_degree(vertex);
+        }
+
+        edge_type add_edge(const edge_type & edge) override;
+        edge_type add_edge(const edge_type & edge, const edge_property_type & property) override;
+
+    private:
+        // every edge once, in the direction it was added
+        std::vector<edge_type> edge_list;
+    };
+
+    template <typename VertexProperty, typename EdgeProperty>
+    typename dense_undirected_graph<VertexProperty, EdgeProperty>::edge_type
+            dense_undirected_graph<VertexProperty, EdgeProperty>::add_edge(const edge_type & edge)
+    {
+        if(this->representation.find_edge(edge.source().id(), edge.destination().id()) != nullptr)
+            throw std::invalid_argument("Edge already exists");
+
+        this->representation.add_edge_to_source(edge);
+        this->representation.add_edge_to_destination(edge);
+        this->edge_list.push_back(edge);
+        return edge;
+    }
+
+    template <typename VertexProperty, typename EdgeProperty>
+    typename dense_undirected_graph<VertexProperty, EdgeProperty>::edge_type
+            dense_undirected_graph<VertexProperty, EdgeProperty>::add_edge(
+                    const edge_type & edge,
+                    const edge_property_type & property)
+    {
+        this->add_edge(edge);
+        this->representation.property(edge) = property;
+        return edge;
+    }
+}
+
+#endif
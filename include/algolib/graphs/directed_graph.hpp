@@ -7,9 +7,9 @@
 
 #include <algorithm>
 #include <exception>
-#include <numeric>
+#include <memory_resource>
 #include <stdexcept>
-#include <unordered_set>
+#include <type_traits>
 #include <vector>
 #include "algolib/graphs/simple_graph.hpp"
 
@@ -29,10 +29,80 @@ namespace algolib::graphs
 
         ~directed_graph() override = default;
 
+        /*!
+         * \brief Gets the predecessors of given vertex.
+         * \param vertex the vertex from this graph
+         * \return the source vertices of edges incoming to the vertex
+         */
+        virtual std::vector<vertex_type> predecessors(const vertex_type & vertex) const = 0;
+
+        /*!
+         * \brief Gets the incoming edges of given vertex.
+         * \param vertex the vertex from this graph
+         * \return the edges incoming to the vertex
+         */
+        virtual std::vector<edge_type> incoming_edges(const vertex_type & vertex) const = 0;
+
+        /*!
+         * \brief Calls given function on each incoming edge of given vertex without copying them.
+         * \param vertex the vertex from this graph
+         * \param function the function to call
+         */
+        virtual void for_each_incoming_edge(const vertex_type & vertex,
+                internal::function_ref<void(const edge_type &)> function) const = 0;
+
+        /*!
+         * \brief Calls given function on each incoming edge of given vertex and its weight.
+         * \param vertex the vertex from this graph
+         * \param function the function to call
+         * \throw std::out_of_range if an incoming edge has no property
+         * \throw std::logic_error if edge properties are not weighted
+         */
+        virtual void for_each_incoming_weighted_edge(const vertex_type & vertex,
+                internal::function_ref<void(const edge_type &, double)> function) const
+        {
+            if constexpr(std::is_base_of_v<weighted, edge_property_type>)
+                this->for_each_incoming_edge(vertex,
+                        [&](const edge_type & edge)
+                        { function(edge, this->properties().at(edge).weight()); });
+            else
+                throw std::logic_error("Edge properties are not weighted");
+        }
+
+        /*!
+         * \brief Checks whether this graph keeps an index of incoming edges, so that incoming
+         * edges of a vertex are found without scanning all edges of the graph.
+         * \return \c true if incoming edges are indexed, otherwise \c false
+         */
+        virtual bool indexes_incoming() const
+        {
+            return false;
+        }
+
+        /*!
+         * \brief Calls given function on each incoming edge of the vertex at given index with the
+         * index of its source, the source and the weight of the edge.
+         * \param index the index of the vertex in this graph with indexed vertices
+         * \param function the function to call
+         * \throw std::out_of_range if an incoming edge has no property
+         * \throw std::logic_error if vertices are not indexed or edge properties are not weighted
+         */
+        virtual void for_each_incoming_indexed_weighted_edge(size_t,
+                internal::function_ref<void(size_t, const vertex_type &, double)>) const
+        {
+            if(!this->is_indexed())
+                throw std::logic_error("Vertices are not indexed");
+        }
+
         //! \brief Reverses directions of all edges in this graph.
         virtual void reverse() = 0;
     };
 
+    template <typename VertexId = size_t,
+            typename VertexProperty = std::nullptr_t,
+            typename EdgeProperty = std::nullptr_t>
+    class directed_frozen_graph;
+
     template <typename VertexId = size_t,
             typename VertexProperty = std::nullptr_t,
             typename EdgeProperty = std::nullptr_t>
@@ -55,8 +125,18 @@ namespace algolib::graphs
         using repr = typename simple_graph<VertexId, VertexProperty, EdgeProperty>::repr;
 
     public:
-        explicit directed_simple_graph(const std::vector<vertex_id_type> & vertex_ids = {})
-            : simple_graph<VertexId, VertexProperty, EdgeProperty>(vertex_ids)
+        /*!
+         * \param vertex_ids the identifiers of initial vertices
+         * \param resource the memory resource to allocate all structures of this graph from
+         * \param index_incoming whether to keep an index of incoming edges of each vertex, which
+         * makes input degrees, predecessors and incoming edges constant-time queries; without it
+         * they scan all edges of the graph
+         */
+        explicit directed_simple_graph(const std::vector<vertex_id_type> & vertex_ids = {},
+                std::pmr::memory_resource * resource = std::pmr::get_default_resource(),
+                bool index_incoming = false)
+            : simple_graph<VertexId, VertexProperty, EdgeProperty>(vertex_ids, resource),
+              index_incoming{index_incoming}
         {
         }
 
@@ -68,11 +148,7 @@ namespace algolib::graphs
 
         size_t edges_count() const override
         {
-            auto edges_set = this->representation.edges_set();
-
-            return std::accumulate(edges_set.begin(), edges_set.end(), 0,
-                    [](size_t acc, const std::unordered_set<edge_type> & edges)
-                    { return acc + edges.size(); });
+            return this->representation.adjacent_edges_total();
         }
 
         std::vector<edge_type> edges() const override
@@ -82,10 +158,20 @@ namespace algolib::graphs
 
         size_t output_degree(const vertex_type & vertex) const override
         {
-            return this->representation.adjacent_edges(vertex).size();
+            return this->representation.adjacent_edges_count(vertex);
         }
 
         size_t input_degree(const vertex_type & vertex) const override;
+        std::vector<vertex_type> predecessors(const vertex_type & vertex) const override;
+        std::vector<edge_type> incoming_edges(const vertex_type & vertex) const override;
+        void for_each_incoming_edge(const vertex_type & vertex,
+                internal::function_ref<void(const edge_type &)> function) const override;
+
+        bool indexes_incoming() const override
+        {
+            return this->index_incoming;
+        }
+
         edge_type add_edge(const edge_type & edge) override;
         edge_type add_edge(const edge_type & edge, const edge_property_type & property) override;
         void reverse() override;
@@ -96,33 +182,91 @@ namespace algolib::graphs
          */
         directed_simple_graph<vertex_id_type, vertex_property_type, edge_property_type>
                 reversed_copy() const;
+
+        /*!
+         * \brief Creates immutable compressed sparse row copy of this graph.
+         * Defined in frozen_graph.hpp, which has to be included to call it.
+         * \return the frozen copy of this graph
+         */
+        directed_frozen_graph<VertexId, VertexProperty, EdgeProperty> freeze() const;
+
+    private:
+        template <typename Graph>
+        friend class graph_builder;
+
+        bool index_incoming;
     };
 
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    void directed_simple_graph<VertexId, VertexProperty, EdgeProperty>::for_each_incoming_edge(
+            const vertex_type & vertex,
+            internal::function_ref<void(const edge_type &)> function) const
+    {
+        if(this->index_incoming)
+        {
+            this->representation.for_each_incoming_edge(vertex, function);
+            return;
+        }
+
+        // validates the vertex, as the scan finds nothing for vertices outside the graph
+        this->representation.adjacent_edges_count(vertex);
+        this->representation.for_each_edge(
+                [&](const edge_type & edge)
+                {
+                    if(edge.destination() == vertex)
+                        function(edge);
+                });
+    }
+
     template <typename VertexId, typename VertexProperty, typename EdgeProperty>
     size_t directed_simple_graph<VertexId, VertexProperty, EdgeProperty>::input_degree(
             const vertex_type & vertex) const
     {
-        size_t degree = 0;
+        if(this->index_incoming)
+            return this->representation.incoming_edges_count(vertex);
 
-        for(auto && edges : this->representation.edges_set())
-            degree += std::count_if(edges.begin(), edges.end(),
-                    [&](auto && edge) { return edge.destination() == vertex; });
+        size_t degree = 0;
 
+        this->for_each_incoming_edge(vertex, [&](const edge_type &) { ++degree; });
         return degree;
     }
 
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    std::vector<typename directed_simple_graph<VertexId, VertexProperty, EdgeProperty>::edge_type>
+            directed_simple_graph<VertexId, VertexProperty, EdgeProperty>::incoming_edges(
+                    const vertex_type & vertex) const
+    {
+        std::vector<edge_type> result;
+
+        this->for_each_incoming_edge(vertex, [&](const edge_type & edge) { result.push_back(edge); });
+        return result;
+    }
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    std::vector<typename directed_simple_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type>
+            directed_simple_graph<VertexId, VertexProperty, EdgeProperty>::predecessors(
+                    const vertex_type & vertex) const
+    {
+        std::vector<vertex_type> result;
+
+        this->for_each_incoming_edge(
+                vertex, [&](const edge_type & edge) { result.push_back(edge.source()); });
+        return result;
+    }
+
     template <typename VertexId, typename VertexProperty, typename EdgeProperty>
     typename directed_simple_graph<VertexId, VertexProperty, EdgeProperty>::edge_type
             directed_simple_graph<VertexId, VertexProperty, EdgeProperty>::add_edge(
                     const edge_type & edge)
-    try
-    {
-        this->operator[](std::make_pair(edge.source(), edge.destination()));
-        throw std::invalid_argument("Edge already exists");
-    }
-    catch(const std::out_of_range &)
     {
+        if(this->representation.find_edge(edge.source().id(), edge.destination().id()) != nullptr)
+            throw std::invalid_argument("Edge already exists");
+
         this->representation.add_edge_to_source(edge);
+
+        if(this->index_incoming)
+            this->representation.add_incoming_edge(edge);
+
         return edge;
     }
 
@@ -131,15 +275,9 @@ namespace algolib::graphs
             directed_simple_graph<VertexId, VertexProperty, EdgeProperty>::add_edge(
                     const edge_type & edge,
                     const edge_property_type & property)
-    try
-    {
-        this->operator[](std::make_pair(edge.source(), edge.destination()));
-        throw std::invalid_argument("Edge already exists");
-    }
-    catch(const std::out_of_range &)
     {
-        this->representation.add_edge_to_source(edge);
-        this->representation.property(edge) = property;
+        this->add_edge(edge);
+        this->representation.set_property(edge, property);
         return edge;
     }
 
@@ -152,20 +290,31 @@ namespace algolib::graphs
         std::transform(std::begin(all_vertices), std::end(all_vertices),
                 std::back_inserter(vertex_ids), [](auto && vertex) { return vertex.id(); });
 
-        repr new_representation(vertex_ids);
+        repr new_representation(vertex_ids, this->representation.resource());
 
         for(auto && vertex : all_vertices)
-            new_representation.property(vertex) = this->representation.property(vertex);
+        {
+            const vertex_property_type * property = this->representation.find_property(vertex);
+
+            if(property != nullptr)
+                new_representation.set_property(vertex, *property);
+        }
 
         for(auto && edge : edges())
         {
             edge_type new_edge = edge.reversed();
+            const edge_property_type * property = this->representation.find_property(edge);
 
             new_representation.add_edge_to_source(new_edge);
-            new_representation.property(new_edge) = this->representation.property(edge);
+
+            if(this->index_incoming)
+                new_representation.add_incoming_edge(new_edge);
+
+            if(property != nullptr)
+                new_representation.set_property(new_edge, *property);
         }
 
-        this->representation = new_representation;
+        this->representation = std::move(new_representation);
     }
 
     template <typename VertexId, typename VertexProperty, typename EdgeProperty>
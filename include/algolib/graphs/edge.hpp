@@ -172,8 +172,7 @@ namespace std
             result_type destination_hash =
                     std::hash<typename argument_type::vertex_type>()(edge.destination_);
 
-            return source_hash
-                   ^ (destination_hash + 0x9e3779b9 + (source_hash << 6) + (source_hash >> 2));
+            return internal::combine_hash(source_hash, destination_hash);
         }
     };
 }
@@ -0,0 +1,262 @@
+/*!
+ * \file edge_list_reader.hpp
+ * \brief Streaming reading of graph edges from text edge lists.
+ */
+#ifndef EDGE_LIST_READER_HPP_
+#define EDGE_LIST_READER_HPP_
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <exception>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "algolib/graphs/graph_builder.hpp"
+#include "algolib/graphs/properties.hpp"
+
+namespace internal
+{
+    template <typename VertexId>
+    struct parsed_edge
+    {
+        VertexId source;
+        VertexId destination;
+        double weight;
+        bool has_weight;
+    };
+
+    inline bool is_edge_list_separator(char character)
+    {
+        return character == ' ' || character == '\t' || character == ',' || character == '\r';
+    }
+
+    inline const char * skip_edge_list_separators(const char * first, const char * last)
+    {
+        return std::find_if_not(first, last, is_edge_list_separator);
+    }
+
+    template <typename Number>
+    const char * parse_edge_list_number(const char * first, const char * last, Number & number)
+    {
+        std::from_chars_result result = std::from_chars(first, last, number);
+
+        if(result.ec != std::errc() || (result.ptr != last && !is_edge_list_separator(*result.ptr)))
+            return nullptr;
+
+        return result.ptr;
+    }
+
+    // Parses lines `source destination [weight]`; empty lines and comments are skipped.
+    template <typename VertexId>
+    void parse_edge_list_line(
+            const char * first, const char * last, std::vector<parsed_edge<VertexId>> & edges)
+    {
+        parsed_edge<VertexId> edge{VertexId(), VertexId(), 0.0, false};
+        const char * position = skip_edge_list_separators(first, last);
+
+        if(position == last || *position == '#' || *position == '%')
+            return;
+
+        position = parse_edge_list_number(position, last, edge.source);
+
+        if(position != nullptr)
+            position = parse_edge_list_number(
+                    skip_edge_list_separators(position, last), last, edge.destination);
+
+        if(position != nullptr)
+        {
+            position = skip_edge_list_separators(position, last);
+
+            if(position != last)
+            {
+                position = parse_edge_list_number(position, last, edge.weight);
+                edge.has_weight = true;
+
+                if(position != nullptr)
+                    position = skip_edge_list_separators(position, last);
+            }
+        }
+
+        if(position != last)
+            throw std::invalid_argument("Invalid edge list line: " + std::string(first, last));
+
+        edges.push_back(edge);
+    }
+
+    template <typename VertexId>
+    void parse_edge_list_chunk(const std::vector<char> & chunk,
+            std::vector<parsed_edge<VertexId>> & edges)
+    {
+        const char * position = chunk.data();
+        const char * last = chunk.data() + chunk.size();
+
+        edges.clear();
+
+        while(position != last)
+        {
+            const char * line_end = std::find(position, last, '\n');
+
+            parse_edge_list_line(position, line_end, edges);
+            position = line_end == last ? last : line_end + 1;
+        }
+    }
+
+    /*
+     * Reads at least chunk_size bytes ending at a line break, keeping the partial line that
+     * follows in rest for the next chunk.
+     */
+    inline bool read_edge_list_chunk(std::istream & input,
+            size_t chunk_size,
+            std::vector<char> & rest,
+            std::vector<char> & chunk)
+    {
+        chunk.swap(rest);
+        rest.clear();
+
+        while(true)
+        {
+            size_t size = chunk.size();
+
+            chunk.resize(size + chunk_size);
+            input.read(chunk.data() + size, chunk_size);
+            chunk.resize(size + input.gcount());
+
+            if(!input)
+                return !chunk.empty();
+
+            auto line_break = std::find(chunk.rbegin(), chunk.rbegin() + input.gcount(), '\n');
+
+            if(line_break != chunk.rbegin() + input.gcount())
+            {
+                rest.assign(line_break.base(), chunk.end());
+                chunk.erase(line_break.base(), chunk.end());
+                return true;
+            }
+        }
+    }
+}
+
+namespace algolib::graphs
+{
+    //! Statistics of reading an edge list.
+    struct edge_list_stats
+    {
+        //! \return the number of edges read per second
+        double edges_per_second() const
+        {
+            return this->seconds > 0 ? this->edges_count / this->seconds : 0.0;
+        }
+
+        size_t edges_count;  //!< number of edges read
+        size_t bytes_count;  //!< number of bytes read
+        double seconds;  //!< time of reading in seconds
+    };
+
+    /*!
+     * \brief Reads edges from text edge list and adds them to given graph builder.
+     * Each line contains a source vertex identifier, a destination vertex identifier and an
+     * optional weight separated with whitespaces or commas. Empty lines and lines starting with
+     * '#' or '%' are skipped. Weights become edge properties when these are weighted and
+     * constructible from a weight, otherwise they are ignored. The input is read in chunks of
+     * given size, which are parsed in parallel and added in order of lines.
+     * \param input the input stream of edge list
+     * \param builder the builder of graph
+     * \param chunk_size the number of bytes in one chunk
+     * \param threads_count the number of threads parsing the chunks
+     * \return the statistics of reading
+     * \throw std::invalid_argument if a line is not a valid edge
+     */
+    template <typename Graph>
+    edge_list_stats read_edge_list(std::istream & input,
+            graph_builder<Graph> & builder,
+            size_t chunk_size = 1 << 22,
+            size_t threads_count = std::thread::hardware_concurrency())
+    {
+        using vertex_id_type = typename Graph::vertex_id_type;
+        using edge_property_type = typename Graph::edge_property_type;
+
+        static_assert(std::is_arithmetic_v<vertex_id_type>,
+                "Edge lists contain numeric vertex identifiers");
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        edge_list_stats stats{0, 0, 0.0};
+
+        threads_count = std::max<size_t>(threads_count, 1);
+        chunk_size = std::max<size_t>(chunk_size, 1);
+
+        std::vector<std::vector<char>> chunks(threads_count);
+        std::vector<std::vector<internal::parsed_edge<vertex_id_type>>> parsed(threads_count);
+        std::vector<std::exception_ptr> errors(threads_count);
+        std::vector<char> rest;
+        bool has_more = true;
+
+        while(has_more)
+        {
+            size_t chunks_count = 0;
+
+            while(chunks_count < threads_count
+                  && (has_more = internal::read_edge_list_chunk(
+                              input, chunk_size, rest, chunks[chunks_count])))
+            {
+                stats.bytes_count += chunks[chunks_count].size();
+                ++chunks_count;
+            }
+
+            if(chunks_count == 1)
+                internal::parse_edge_list_chunk(chunks[0], parsed[0]);
+            else if(chunks_count > 1)
+            {
+                std::vector<std::thread> threads;
+
+                for(size_t i = 0; i < chunks_count; ++i)
+                    threads.emplace_back(
+                            [&, i]()
+                            {
+                                try
+                                {
+                                    internal::parse_edge_list_chunk(chunks[i], parsed[i]);
+                                }
+                                catch(...)
+                                {
+                                    errors[i] = std::current_exception();
+                                }
+                            });
+
+                for(auto && thread : threads)
+                    thread.join();
+
+                for(size_t i = 0; i < chunks_count; ++i)
+                    if(errors[i])
+                        std::rethrow_exception(errors[i]);
+            }
+
+            for(size_t i = 0; i < chunks_count; ++i)
+            {
+                for(auto && edge : parsed[i])
+                    if constexpr(std::is_base_of_v<weighted, edge_property_type>
+                                 && std::is_constructible_v<edge_property_type, double>)
+                    {
+                        if(edge.has_weight)
+                            builder.add_edge(edge.source, edge.destination,
+                                    edge_property_type(edge.weight));
+                        else
+                            builder.add_edge(edge.source, edge.destination);
+                    }
+                    else
+                        builder.add_edge(edge.source, edge.destination);
+
+                stats.edges_count += parsed[i].size();
+            }
+        }
+
+        stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+                                .count();
+        return stats;
+    }
+}
+
+#endif
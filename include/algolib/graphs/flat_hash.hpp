@@ -0,0 +1,656 @@
+/*!
+ * \file flat_hash.hpp
+ * \brief Flat open-addressing hash tables and hash mixing for graph structures.
+ */
+#ifndef FLAT_HASH_HPP_
+#define FLAT_HASH_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace internal
+{
+    // Spreads bits of a hash over the whole word with the finaliser of splitmix64, so that
+    // consecutive identifiers land in distant slots of hash tables.
+    inline size_t mix_hash(size_t value)
+    {
+        uint64_t mixed = static_cast<uint64_t>(value) + 0x9e3779b97f4a7c15ULL;
+
+        mixed = (mixed ^ (mixed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        mixed = (mixed ^ (mixed >> 27)) * 0x94d049bb133111ebULL;
+        return static_cast<size_t>(mixed ^ (mixed >> 31));
+    }
+
+    // Combines two hashes into one; the result depends on the order of arguments.
+    inline size_t combine_hash(size_t first_hash, size_t second_hash)
+    {
+        return mix_hash(first_hash ^ (second_hash + 0x9e3779b9 + (first_hash << 6)
+                                             + (first_hash >> 2)));
+    }
+
+    /*
+     * Hash table with open addressing and linear probing. Control bytes, keys and mapped values
+     * are kept in three separate arrays, so a probe reads consecutive control bytes and compares
+     * a key only when the seven hash bits stored in its control byte match. Removal shifts
+     * following entries back instead of leaving tombstones. Any modification invalidates all
+     * iterators, pointers and references to elements. With void mapped type the table is a set.
+     */
+    template <typename Key,
+            typename Mapped,
+            typename Hash = std::hash<Key>,
+            typename KeyEqual = std::equal_to<Key>,
+            typename Allocator = std::allocator<Key>>
+    class flat_hash_table
+    {
+        static constexpr bool is_map = !std::is_void_v<Mapped>;
+
+        using mapped_storage = std::conditional_t<is_map, Mapped, char>;
+        using key_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Key>;
+        using mapped_allocator =
+                typename std::allocator_traits<Allocator>::template rebind_alloc<mapped_storage>;
+        using control_allocator =
+                typename std::allocator_traits<Allocator>::template rebind_alloc<uint8_t>;
+        using key_traits = std::allocator_traits<key_allocator>;
+        using mapped_traits = std::allocator_traits<mapped_allocator>;
+        using control_traits = std::allocator_traits<control_allocator>;
+
+        static constexpr uint8_t empty_control = 0;
+        static constexpr size_t minimal_capacity = 8;
+
+        template <bool Constant>
+        class basic_iterator;
+
+    public:
+        using key_type = Key;
+        using mapped_type = Mapped;
+        using size_type = size_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using allocator_type = Allocator;
+        using iterator = basic_iterator<!is_map>;
+        using const_iterator = basic_iterator<true>;
+
+        flat_hash_table() : flat_hash_table(allocator_type())
+        {
+        }
+
+        explicit flat_hash_table(const allocator_type & allocator) : allocator_{allocator}
+        {
+        }
+
+        flat_hash_table(const flat_hash_table & table)
+            : flat_hash_table(table,
+                    std::allocator_traits<Allocator>::select_on_container_copy_construction(
+                            table.allocator_))
+        {
+        }
+
+        flat_hash_table(const flat_hash_table & table, const allocator_type & allocator)
+            : allocator_{allocator}, hash_{table.hash_}, equal_{table.equal_}
+        {
+            this->copy_from(table);
+        }
+
+        flat_hash_table(flat_hash_table && table) noexcept
+            : allocator_{table.allocator_}, hash_{table.hash_}, equal_{table.equal_}
+        {
+            this->steal(table);
+        }
+
+        flat_hash_table(flat_hash_table && table, const allocator_type & allocator)
+            : allocator_{allocator}, hash_{table.hash_}, equal_{table.equal_}
+        {
+            if(this->allocator_ == table.allocator_)
+                this->steal(table);
+            else
+                this->copy_from(table);
+        }
+
+        ~flat_hash_table()
+        {
+            this->release();
+        }
+
+        flat_hash_table & operator=(const flat_hash_table & table)
+        {
+            if(this != &table)
+            {
+                this->release();
+
+                if constexpr(std::allocator_traits<
+                                     Allocator>::propagate_on_container_copy_assignment::value)
+                    this->allocator_ = table.allocator_;
+
+                this->hash_ = table.hash_;
+                this->equal_ = table.equal_;
+                this->copy_from(table);
+            }
+
+            return *this;
+        }
+
+        flat_hash_table & operator=(flat_hash_table && table)
+        {
+            if(this != &table)
+            {
+                this->release();
+
+                if constexpr(std::allocator_traits<
+                                     Allocator>::propagate_on_container_move_assignment::value)
+                    this->allocator_ = table.allocator_;
+
+                this->hash_ = table.hash_;
+                this->equal_ = table.equal_;
+
+                if(this->allocator_ == table.allocator_)
+                    this->steal(table);
+                else
+                    this->copy_from(table);
+            }
+
+            return *this;
+        }
+
+        allocator_type get_allocator() const
+        {
+            return this->allocator_;
+        }
+
+        size_t size() const
+        {
+            return this->size_;
+        }
+
+        bool empty() const
+        {
+            return this->size_ == 0;
+        }
+
+        size_t capacity() const
+        {
+            return this->capacity_;
+        }
+
+        iterator begin()
+        {
+            return iterator(this, this->next_occupied(0));
+        }
+
+        const_iterator begin() const
+        {
+            return const_iterator(this, this->next_occupied(0));
+        }
+
+        iterator end()
+        {
+            return iterator(this, this->capacity_);
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator(this, this->capacity_);
+        }
+
+        iterator find(const key_type & key)
+        {
+            return iterator(this, this->find_index(key));
+        }
+
+        const_iterator find(const key_type & key) const
+        {
+            return const_iterator(this, this->find_index(key));
+        }
+
+        size_t count(const key_type & key) const
+        {
+            return this->find_index(key) == this->capacity_ ? 0 : 1;
+        }
+
+        bool contains(const key_type & key) const
+        {
+            return this->count(key) > 0;
+        }
+
+        // Inserts key with value constructed from arguments unless the key is already present.
+        template <typename... Args>
+        std::pair<iterator, bool> emplace(const key_type & key, Args &&... args)
+        {
+            size_t index = this->find_index(key);
+
+            if(index != this->capacity_)
+                return std::make_pair(iterator(this, index), false);
+
+            this->reserve(this->size_ + 1);
+            index = this->insert_index(key);
+            this->construct_key(index, key);
+
+            if constexpr(is_map)
+                try
+                {
+                    this->construct_value(index, std::forward<Args>(args)...);
+                }
+                catch(...)
+                {
+                    this->destroy_key(this->keys + index);
+                    throw;
+                }
+
+            this->controls[index] = control_byte(this->hash_(key));
+            ++this->size_;
+            return std::make_pair(iterator(this, index), true);
+        }
+
+        std::pair<iterator, bool> insert(const key_type & key)
+        {
+            return this->emplace(key);
+        }
+
+        template <bool M = is_map, std::enable_if_t<M, int> = 0>
+        mapped_storage & operator[](const key_type & key)
+        {
+            size_t index = this->emplace(key).first.index;
+
+            return this->values[index];
+        }
+
+        template <bool M = is_map, std::enable_if_t<M, int> = 0>
+        mapped_storage & at(const key_type & key)
+        {
+            return const_cast<mapped_storage &>(std::as_const(*this).at(key));
+        }
+
+        template <bool M = is_map, std::enable_if_t<M, int> = 0>
+        const mapped_storage & at(const key_type & key) const
+        {
+            size_t index = this->find_index(key);
+
+            if(index == this->capacity_)
+                throw std::out_of_range("Key not found");
+
+            return this->values[index];
+        }
+
+        size_t erase(const key_type & key)
+        {
+            size_t index = this->find_index(key);
+
+            if(index == this->capacity_)
+                return 0;
+
+            this->destroy_at(index);
+            --this->size_;
+
+            // moves back following entries of the probe sequence, so no probe ever skips a hole
+            size_t mask = this->capacity_ - 1;
+            size_t hole = index;
+
+            for(size_t next = (hole + 1) & mask; this->controls[next] != empty_control;
+                    next = (next + 1) & mask)
+            {
+                size_t home = this->hash_(this->keys[next]) & mask;
+
+                if(((next - home) & mask) >= ((next - hole) & mask))
+                {
+                    this->move_slot(next, hole);
+                    hole = next;
+                }
+            }
+
+            return 1;
+        }
+
+        void clear()
+        {
+            for(size_t i = 0; i < this->capacity_; ++i)
+                if(this->controls[i] != empty_control)
+                    this->destroy_at(i);
+
+            this->size_ = 0;
+        }
+
+        // Makes room for given number of elements without rehashing.
+        void reserve(size_t count)
+        {
+            if(count * 8 <= this->capacity_ * 7)
+                return;
+
+            size_t new_capacity = std::max(this->capacity_, minimal_capacity);
+
+            while(count * 8 > new_capacity * 7)
+                new_capacity *= 2;
+
+            this->rehash(new_capacity);
+        }
+
+    private:
+        template <bool Constant>
+        class basic_iterator
+        {
+            using table_pointer =
+                    std::conditional_t<Constant, const flat_hash_table *, flat_hash_table *>;
+            using mapped_reference =
+                    std::conditional_t<Constant, const mapped_storage &, mapped_storage &>;
+
+            struct arrow_proxy
+            {
+                std::pair<const Key &, mapped_reference> entry;
+
+                const std::pair<const Key &, mapped_reference> * operator->() const
+                {
+                    return &this->entry;
+                }
+            };
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = std::conditional_t<is_map, std::pair<Key, mapped_storage>, Key>;
+            using reference = std::conditional_t<is_map,
+                    std::pair<const Key &, mapped_reference>, const Key &>;
+            using pointer = std::conditional_t<is_map, arrow_proxy, const Key *>;
+
+            basic_iterator() = default;
+
+            basic_iterator(table_pointer table, size_t index) : table{table}, index{index}
+            {
+            }
+
+            // Constant iterators are created from mutable ones.
+            template <bool C = Constant, std::enable_if_t<C, int> = 0>
+            basic_iterator(const basic_iterator<false> & it) : table{it.table}, index{it.index}
+            {
+            }
+
+            reference operator*() const
+            {
+                if constexpr(is_map)
+                    return reference(this->table->keys[this->index],
+                            this->table->values[this->index]);
+                else
+                    return this->table->keys[this->index];
+            }
+
+            pointer operator->() const
+            {
+                if constexpr(is_map)
+                    return arrow_proxy{**this};
+                else
+                    return this->table->keys + this->index;
+            }
+
+            basic_iterator & operator++()
+            {
+                this->index = this->table->next_occupied(this->index + 1);
+                return *this;
+            }
+
+            basic_iterator operator++(int)
+            {
+                basic_iterator it = *this;
+
+                ++*this;
+                return it;
+            }
+
+            friend bool operator==(const basic_iterator & it1, const basic_iterator & it2)
+            {
+                return it1.index == it2.index;
+            }
+
+            friend bool operator!=(const basic_iterator & it1, const basic_iterator & it2)
+            {
+                return !(it1 == it2);
+            }
+
+        private:
+            friend class flat_hash_table;
+            friend class basic_iterator<!Constant>;
+
+            table_pointer table = nullptr;
+            size_t index = 0;
+        };
+
+        // Marks slot as occupied and keeps seven more bits of hash to filter key comparisons.
+        static uint8_t control_byte(size_t hash)
+        {
+            return static_cast<uint8_t>(0x80 | (hash >> (8 * sizeof(size_t) - 7)));
+        }
+
+        template <typename... Args>
+        void construct_key(size_t index, Args &&... args)
+        {
+            key_allocator allocator(this->allocator_);
+
+            key_traits::construct(allocator, this->keys + index, std::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        void construct_value(size_t index, Args &&... args)
+        {
+            mapped_allocator allocator(this->allocator_);
+
+            mapped_traits::construct(allocator, this->values + index, std::forward<Args>(args)...);
+        }
+
+        void destroy_key(Key * key)
+        {
+            key_allocator allocator(this->allocator_);
+
+            key_traits::destroy(allocator, key);
+        }
+
+        void destroy_value(mapped_storage * value)
+        {
+            mapped_allocator allocator(this->allocator_);
+
+            mapped_traits::destroy(allocator, value);
+        }
+
+        size_t next_occupied(size_t index) const
+        {
+            while(index < this->capacity_ && this->controls[index] == empty_control)
+                ++index;
+
+            return index;
+        }
+
+        size_t find_index(const key_type & key) const
+        {
+            if(this->size_ == 0)
+                return this->capacity_;
+
+            size_t hash = this->hash_(key);
+            uint8_t control = control_byte(hash);
+            size_t mask = this->capacity_ - 1;
+
+            for(size_t i = hash & mask; this->controls[i] != empty_control; i = (i + 1) & mask)
+                if(this->controls[i] == control && this->equal_(this->keys[i], key))
+                    return i;
+
+            return this->capacity_;
+        }
+
+        // Finds an empty slot for key known to be absent.
+        size_t insert_index(const key_type & key) const
+        {
+            size_t mask = this->capacity_ - 1;
+            size_t i = this->hash_(key) & mask;
+
+            while(this->controls[i] != empty_control)
+                i = (i + 1) & mask;
+
+            return i;
+        }
+
+        void destroy_at(size_t index)
+        {
+            this->destroy_key(this->keys + index);
+
+            if constexpr(is_map)
+                this->destroy_value(this->values + index);
+
+            this->controls[index] = empty_control;
+        }
+
+        void move_slot(size_t source, size_t destination)
+        {
+            this->construct_key(destination, std::move(this->keys[source]));
+
+            if constexpr(is_map)
+                this->construct_value(destination, std::move(this->values[source]));
+
+            this->controls[destination] = this->controls[source];
+            this->destroy_at(source);
+        }
+
+        void allocate(size_t capacity)
+        {
+            control_allocator controls_allocator(this->allocator_);
+            key_allocator keys_allocator(this->allocator_);
+
+            this->controls = control_traits::allocate(controls_allocator, capacity);
+            std::fill(this->controls, this->controls + capacity, empty_control);
+            this->keys = key_traits::allocate(keys_allocator, capacity);
+
+            if constexpr(is_map)
+            {
+                mapped_allocator values_allocator(this->allocator_);
+
+                this->values = mapped_traits::allocate(values_allocator, capacity);
+            }
+
+            this->capacity_ = capacity;
+        }
+
+        void deallocate(uint8_t * controls, Key * keys, mapped_storage * values, size_t capacity)
+        {
+            if(capacity == 0)
+                return;
+
+            control_allocator controls_allocator(this->allocator_);
+            key_allocator keys_allocator(this->allocator_);
+
+            control_traits::deallocate(controls_allocator, controls, capacity);
+            key_traits::deallocate(keys_allocator, keys, capacity);
+
+            if constexpr(is_map)
+            {
+                mapped_allocator values_allocator(this->allocator_);
+
+                mapped_traits::deallocate(values_allocator, values, capacity);
+            }
+        }
+
+        void release()
+        {
+            this->clear();
+            this->deallocate(this->controls, this->keys, this->values, this->capacity_);
+            this->controls = nullptr;
+            this->keys = nullptr;
+            this->values = nullptr;
+            this->capacity_ = 0;
+        }
+
+        void rehash(size_t new_capacity)
+        {
+            uint8_t * old_controls = this->controls;
+            Key * old_keys = this->keys;
+            mapped_storage * old_values = this->values;
+            size_t old_capacity = this->capacity_;
+
+            this->allocate(new_capacity);
+
+            for(size_t i = 0; i < old_capacity; ++i)
+                if(old_controls[i] != empty_control)
+                {
+                    size_t index = this->insert_index(old_keys[i]);
+
+                    this->construct_key(index, std::move(old_keys[i]));
+                    this->destroy_key(old_keys + i);
+
+                    if constexpr(is_map)
+                    {
+                        this->construct_value(index, std::move(old_values[i]));
+                        this->destroy_value(old_values + i);
+                    }
+
+                    this->controls[index] = old_controls[i];
+                }
+
+            this->deallocate(old_controls, old_keys, old_values, old_capacity);
+        }
+
+        // Copies elements to the same slots, so no hash is computed.
+        void copy_from(const flat_hash_table & table)
+        {
+            if(table.size_ == 0)
+                return;
+
+            this->allocate(table.capacity_);
+
+            for(size_t i = 0; i < table.capacity_; ++i)
+                if(table.controls[i] != empty_control)
+                {
+                    this->construct_key(i, table.keys[i]);
+
+                    if constexpr(is_map)
+                        this->construct_value(i, table.values[i]);
+
+                    this->controls[i] = table.controls[i];
+                    ++this->size_;
+                }
+        }
+
+        void steal(flat_hash_table & table)
+        {
+            this->controls = std::exchange(table.controls, nullptr);
+            this->keys = std::exchange(table.keys, nullptr);
+            this->values = std::exchange(table.values, nullptr);
+            this->capacity_ = std::exchange(table.capacity_, 0);
+            this->size_ = std::exchange(table.size_, 0);
+        }
+
+        Allocator allocator_;
+        Hash hash_;
+        KeyEqual equal_;
+        uint8_t * controls = nullptr;
+        Key * keys = nullptr;
+        mapped_storage * values = nullptr;
+        size_t capacity_ = 0;
+        size_t size_ = 0;
+    };
+
+    template <typename Key,
+            typename Value,
+            typename Hash = std::hash<Key>,
+            typename KeyEqual = std::equal_to<Key>,
+            typename Allocator = std::allocator<Key>>
+    using flat_hash_map = flat_hash_table<Key, Value, Hash, KeyEqual, Allocator>;
+
+    template <typename Key,
+            typename Hash = std::hash<Key>,
+            typename KeyEqual = std::equal_to<Key>,
+            typename Allocator = std::allocator<Key>>
+    using flat_hash_set = flat_hash_table<Key, void, Hash, KeyEqual, Allocator>;
+
+    namespace pmr
+    {
+        template <typename Key, typename Value, typename Hash = std::hash<Key>>
+        using flat_hash_map = internal::flat_hash_map<Key, Value, Hash, std::equal_to<Key>,
+                std::pmr::polymorphic_allocator<Key>>;
+
+        template <typename Key, typename Hash = std::hash<Key>>
+        using flat_hash_set = internal::flat_hash_set<Key, Hash, std::equal_to<Key>,
+                std::pmr::polymorphic_allocator<Key>>;
+    }
+}
+
+#endif
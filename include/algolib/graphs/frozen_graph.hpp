@@ -0,0 +1,1150 @@
+/*!
+ * \file frozen_graph.hpp
+ * \brief Structure of immutable graph in compressed sparse row form.
+ */
+#ifndef FROZEN_GRAPH_HPP_
+#define FROZEN_GRAPH_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "algolib/graphs/directed_graph.hpp"
+#include "algolib/graphs/flat_hash.hpp"
+#include "algolib/graphs/graph.hpp"
+#include "algolib/graphs/simple_graph.hpp"
+#include "algolib/graphs/undirected_graph.hpp"
+
+namespace internal
+{
+    namespace algr = algolib::graphs;
+
+    // Packs edges given as pairs of vertex indices into rows sorted by neighbour index.
+    inline void pack_rows(size_t vertices_count,
+            const std::vector<std::pair<size_t, size_t>> & endpoints,
+            bool symmetric,
+            std::vector<size_t> & row_offsets,
+            std::vector<size_t> & row_neighbours,
+            std::vector<size_t> & row_edges)
+    {
+        std::vector<std::pair<size_t, size_t>> slots;
+
+        row_offsets.assign(vertices_count + 1, 0);
+
+        for(auto && endpoint : endpoints)
+        {
+            ++row_offsets[endpoint.first + 1];
+
+            if(symmetric && endpoint.first != endpoint.second)
+                ++row_offsets[endpoint.second + 1];
+        }
+
+        std::partial_sum(row_offsets.begin(), row_offsets.end(), row_offsets.begin());
+
+        std::vector<size_t> positions(row_offsets.begin(), row_offsets.end() - 1);
+
+        slots.resize(row_offsets.back());
+
+        for(size_t i = 0; i < endpoints.size(); ++i)
+        {
+            slots[positions[endpoints[i].first]++] = std::make_pair(endpoints[i].second, i);
+
+            if(symmetric && endpoints[i].first != endpoints[i].second)
+                slots[positions[endpoints[i].second]++] = std::make_pair(endpoints[i].first, i);
+        }
+
+        row_neighbours.clear();
+        row_edges.clear();
+        row_neighbours.reserve(slots.size());
+        row_edges.reserve(slots.size());
+
+        for(size_t i = 0; i < vertices_count; ++i)
+        {
+            std::sort(slots.begin() + row_offsets[i], slots.begin() + row_offsets[i + 1]);
+
+            for(size_t j = row_offsets[i]; j < row_offsets[i + 1]; ++j)
+            {
+                row_neighbours.push_back(slots[j].first);
+                row_edges.push_back(slots[j].second);
+            }
+        }
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    class csr_representation
+    {
+    public:
+        using vertex_id_type = VertexId;
+        using vertex_type = Vertex;
+        using edge_type = Edge;
+        using vertex_property_type = VertexProperty;
+        using edge_property_type = EdgeProperty;
+        using source_type =
+                graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>;
+
+        csr_representation(const source_type & source, bool directed);
+
+        ~csr_representation() = default;
+        csr_representation(const csr_representation &) = default;
+        csr_representation(csr_representation &&) = default;
+        csr_representation & operator=(const csr_representation &) = default;
+        csr_representation & operator=(csr_representation &&) = default;
+
+        size_t size() const
+        {
+            return this->vertices_.size();
+        }
+
+        size_t edges_count() const
+        {
+            return this->edges_.size();
+        }
+
+        const std::vector<vertex_type> & vertices() const
+        {
+            return this->vertices_;
+        }
+
+        const std::vector<edge_type> & edges() const
+        {
+            return this->edges_;
+        }
+
+        size_t degree(size_t index) const
+        {
+            return this->offsets[index + 1] - this->offsets[index];
+        }
+
+        size_t input_degree(size_t index) const
+        {
+            return this->input_offsets[index + 1] - this->input_offsets[index];
+        }
+
+        std::pair<const size_t *, const size_t *> neighbour_row(size_t index) const
+        {
+            return std::make_pair(this->neighbour_indices.data() + this->offsets[index],
+                    this->neighbour_indices.data() + this->offsets[index + 1]);
+        }
+
+        // rows of undirected graphs are symmetric, so their input rows are not kept
+        std::pair<const size_t *, const size_t *> input_row(size_t index) const
+        {
+            if(this->input_neighbour_indices.empty())
+                return this->neighbour_row(index);
+
+            return std::make_pair(this->input_neighbour_indices.data() + this->input_offsets[index],
+                    this->input_neighbour_indices.data() + this->input_offsets[index + 1]);
+        }
+
+        const vertex_type & operator[](const vertex_id_type & vertex_id) const;
+        const edge_type & operator[](
+                const std::pair<vertex_id_type, vertex_id_type> & vertex_ids) const;
+
+        size_t index(const vertex_type & vertex) const;
+        std::vector<edge_type> adjacent_edges(const vertex_type & vertex) const;
+        std::vector<vertex_type> neighbours(const vertex_type & vertex) const;
+
+        template <typename Function>
+        void for_each_neighbour(const vertex_type & vertex, Function && function) const
+        {
+            size_t vertex_index = this->index(vertex);
+
+            for(size_t i = this->offsets[vertex_index]; i < this->offsets[vertex_index + 1]; ++i)
+                function(this->vertices_[this->neighbour_indices[i]]);
+        }
+
+        template <typename Function>
+        bool any_neighbour(const vertex_type & vertex, Function && function) const
+        {
+            size_t vertex_index = this->index(vertex);
+
+            for(size_t i = this->offsets[vertex_index]; i < this->offsets[vertex_index + 1]; ++i)
+                if(function(this->vertices_[this->neighbour_indices[i]]))
+                    return true;
+
+            return false;
+        }
+
+        template <typename Function>
+        void for_each_adjacent_edge(const vertex_type & vertex, Function && function) const
+        {
+            size_t vertex_index = this->index(vertex);
+
+            for(size_t i = this->offsets[vertex_index]; i < this->offsets[vertex_index + 1]; ++i)
+                function(this->edges_[this->edge_indices[i]]);
+        }
+
+        template <typename Function>
+        void for_each_weighted_edge(const vertex_type & vertex, Function && function) const
+        {
+            size_t vertex_index = this->index(vertex);
+            std::shared_ptr<const std::vector<double>> weights = this->weights_column();
+
+            for(size_t i = this->offsets[vertex_index]; i < this->offsets[vertex_index + 1]; ++i)
+                function(this->edges_[this->edge_indices[i]], this->row_weight(*weights, i));
+        }
+
+        template <typename Function>
+        void for_each_indexed_weighted_edge(size_t vertex_index, Function && function) const
+        {
+            std::shared_ptr<const std::vector<double>> weights = this->weights_column();
+
+            for(size_t i = this->offsets[vertex_index]; i < this->offsets[vertex_index + 1]; ++i)
+                function(this->neighbour_indices[i], this->vertices_[this->neighbour_indices[i]],
+                        this->row_weight(*weights, i));
+        }
+
+        template <typename Function>
+        void for_each_incoming_edge(const vertex_type & vertex, Function && function) const
+        {
+            size_t vertex_index = this->index(vertex);
+
+            for(size_t i = this->input_offsets[vertex_index];
+                    i < this->input_offsets[vertex_index + 1]; ++i)
+                function(this->edges_[this->input_edge_indices[i]]);
+        }
+
+        // The weights column follows outgoing rows, so weights of incoming edges are read from
+        // their properties, which are indexed by edges without lookups.
+        template <typename Function>
+        void for_each_incoming_weighted_edge(const vertex_type & vertex, Function && function) const
+        {
+            size_t vertex_index = this->index(vertex);
+
+            for(size_t i = this->input_offsets[vertex_index];
+                    i < this->input_offsets[vertex_index + 1]; ++i)
+                function(this->edges_[this->input_edge_indices[i]],
+                        this->property_weight(this->input_edge_indices[i]));
+        }
+
+        template <typename Function>
+        void for_each_incoming_indexed_weighted_edge(size_t vertex_index, Function && function)
+                const
+        {
+            for(size_t i = this->input_offsets[vertex_index];
+                    i < this->input_offsets[vertex_index + 1]; ++i)
+                function(this->input_neighbour_indices[i],
+                        this->vertices_[this->input_neighbour_indices[i]],
+                        this->property_weight(this->input_edge_indices[i]));
+        }
+
+        std::vector<edge_type> incoming_edges(const vertex_type & vertex) const;
+        std::vector<vertex_type> predecessors(const vertex_type & vertex) const;
+        vertex_property_type & property(const vertex_type & vertex);
+        vertex_property_type & property_at(const vertex_type & vertex);
+        const vertex_property_type & property_at(const vertex_type & vertex) const;
+        edge_property_type & property(const edge_type & edge);
+        edge_property_type & property_at(const edge_type & edge);
+        const edge_property_type & property_at(const edge_type & edge) const;
+        csr_representation reversed() const;
+
+    private:
+        csr_representation() = default;
+
+        void build_rows(bool directed);
+        std::optional<size_t> find_edge(size_t source_index, size_t destination_index) const;
+        size_t edge_index(const edge_type & edge) const;
+        std::shared_ptr<const std::vector<double>> weights_column() const;
+
+        // Gets the weight of the edge at given position in rows, from the column unless the edge
+        // property is writable.
+        double row_weight(const std::vector<double> & weights, size_t position) const
+        {
+            size_t edge_index = this->edge_indices[position];
+
+            if(!this->writable_edges.empty() && this->writable_edges[edge_index])
+                return this->property_weight(edge_index);
+
+            if(std::isnan(weights[position]))
+                throw std::out_of_range("Property not found for edge");
+
+            return weights[position];
+        }
+
+        double property_weight(size_t edge_index) const
+        {
+            if(!this->edge_properties[edge_index])
+                throw std::out_of_range("Property not found for edge");
+
+            return this->edge_properties[edge_index]->weight();
+        }
+
+        void mark_writable(size_t edge_index)
+        {
+            if(this->writable_edges.empty())
+                this->writable_edges.resize(this->edges_.size());
+
+            this->writable_edges[edge_index] = true;
+        }
+
+        std::vector<vertex_type> vertices_;
+        std::vector<edge_type> edges_;
+        flat_hash_map<vertex_type, size_t> indices;
+        std::vector<size_t> offsets;
+        std::vector<size_t> neighbour_indices;
+        std::vector<size_t> edge_indices;
+        // rows of incoming edges, built only for directed graphs
+        std::vector<size_t> input_offsets;
+        std::vector<size_t> input_neighbour_indices;
+        std::vector<size_t> input_edge_indices;
+        std::vector<std::optional<vertex_property_type>> vertex_properties;
+        std::vector<std::optional<edge_property_type>> edge_properties;
+        // weights of edges in order of rows, NaN for no property; built on first use
+        mutable std::shared_ptr<const std::vector<double>> weights;
+        // edges with properties handed out for writing, whose weights may change at any time, so
+        // they are read from the properties instead of the weights; empty if there are none
+        std::vector<bool> writable_edges;
+    };
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::csr_representation(
+            const source_type & source,
+            bool directed)
+        : vertices_{source.vertices()}
+    {
+        std::sort(this->vertices_.begin(), this->vertices_.end());
+
+        for(size_t i = 0; i < this->vertices_.size(); ++i)
+        {
+            const vertex_property_type * property = source.find_property(this->vertices_[i]);
+
+            this->indices.emplace(this->vertices_[i], i);
+            this->vertex_properties.push_back(
+                    property == nullptr ? std::nullopt : std::make_optional(*property));
+        }
+
+        // every edge is kept exactly once, in the adjacency of its source vertex
+        for(auto && vertex : this->vertices_)
+            for(auto && edge : source.adjacent_edges(vertex))
+                if(edge.source() == vertex)
+                    this->edges_.push_back(edge);
+
+        std::sort(this->edges_.begin(), this->edges_.end());
+
+        for(auto && edge : this->edges_)
+        {
+            const edge_property_type * property = source.find_property(edge);
+
+            this->edge_properties.push_back(
+                    property == nullptr ? std::nullopt : std::make_optional(*property));
+        }
+
+        this->build_rows(directed);
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    const typename csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            vertex_type &
+            csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::operator[](
+                    const vertex_id_type & vertex_id) const
+    {
+        auto it = this->indices.find(vertex_type(vertex_id));
+
+        if(it != this->indices.end())
+            return this->vertices_[it->second];
+
+        throw std::out_of_range("Vertex not found");
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    const typename csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            edge_type &
+            csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::operator[](
+                    const std::pair<vertex_id_type, vertex_id_type> & vertex_ids) const
+    {
+        auto source_it = this->indices.find(vertex_type(vertex_ids.first));
+        auto destination_it = this->indices.find(vertex_type(vertex_ids.second));
+
+        if(source_it != this->indices.end() && destination_it != this->indices.end())
+        {
+            std::optional<size_t> edge_index =
+                    this->find_edge(source_it->second, destination_it->second);
+
+            if(edge_index)
+                return this->edges_[*edge_index];
+        }
+
+        throw std::out_of_range("Edge not found");
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    size_t csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::index(
+            const vertex_type & vertex) const
+    {
+        auto it = this->indices.find(vertex);
+
+        if(it == this->indices.end())
+            throw std::invalid_argument("Vertex does not belong to the graph");
+
+        return it->second;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    std::vector<
+            typename csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+                    edge_type
+    > csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::adjacent_edges(
+            const vertex_type & vertex) const
+    {
+        size_t vertex_index = this->index(vertex);
+        std::vector<edge_type> result;
+
+        result.reserve(this->degree(vertex_index));
+
+        for(size_t i = this->offsets[vertex_index]; i < this->offsets[vertex_index + 1]; ++i)
+            result.push_back(this->edges_[this->edge_indices[i]]);
+
+        return result;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    std::vector<
+            typename csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+                    vertex_type
+    > csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::neighbours(
+            const vertex_type & vertex) const
+    {
+        size_t vertex_index = this->index(vertex);
+        std::vector<vertex_type> result;
+
+        result.reserve(this->degree(vertex_index));
+
+        for(size_t i = this->offsets[vertex_index]; i < this->offsets[vertex_index + 1]; ++i)
+            result.push_back(this->vertices_[this->neighbour_indices[i]]);
+
+        return result;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    std::vector<
+            typename csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+                    edge_type
+    > csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::incoming_edges(
+            const vertex_type & vertex) const
+    {
+        size_t vertex_index = this->index(vertex);
+        std::vector<edge_type> result;
+
+        result.reserve(this->input_degree(vertex_index));
+
+        for(size_t i = this->input_offsets[vertex_index];
+                i < this->input_offsets[vertex_index + 1]; ++i)
+            result.push_back(this->edges_[this->input_edge_indices[i]]);
+
+        return result;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    std::vector<
+            typename csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+                    vertex_type
+    > csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::predecessors(
+            const vertex_type & vertex) const
+    {
+        size_t vertex_index = this->index(vertex);
+        std::vector<vertex_type> result;
+
+        result.reserve(this->input_degree(vertex_index));
+
+        for(size_t i = this->input_offsets[vertex_index];
+                i < this->input_offsets[vertex_index + 1]; ++i)
+            result.push_back(this->vertices_[this->input_neighbour_indices[i]]);
+
+        return result;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    typename csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            vertex_property_type &
+            csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::property(
+                    const vertex_type & vertex)
+    {
+        std::optional<vertex_property_type> & property =
+                this->vertex_properties[this->index(vertex)];
+
+        if(!property)
+            property.emplace();
+
+        return *property;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    typename csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            vertex_property_type &
+            csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::property_at(
+                    const vertex_type & vertex)
+    {
+        std::optional<vertex_property_type> & property =
+                this->vertex_properties[this->index(vertex)];
+
+        if(!property)
+            throw std::out_of_range("Property not found for vertex");
+
+        return *property;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    const typename csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            vertex_property_type &
+            csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::property_at(
+                    const vertex_type & vertex) const
+    {
+        const std::optional<vertex_property_type> & property =
+                this->vertex_properties[this->index(vertex)];
+
+        if(!property)
+            throw std::out_of_range("Property not found for vertex");
+
+        return *property;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    typename csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            edge_property_type &
+            csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::property(
+                    const edge_type & edge)
+    {
+        size_t index = this->edge_index(edge);
+        std::optional<edge_property_type> & property = this->edge_properties[index];
+
+        if(!property)
+            property.emplace();
+
+        this->mark_writable(index);
+        return *property;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    typename csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            edge_property_type &
+            csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::property_at(
+                    const edge_type & edge)
+    {
+        size_t index = this->edge_index(edge);
+        std::optional<edge_property_type> & property = this->edge_properties[index];
+
+        if(!property)
+            throw std::out_of_range("Property not found for edge");
+
+        this->mark_writable(index);
+        return *property;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    const typename csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            edge_property_type &
+            csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::property_at(
+                    const edge_type & edge) const
+    {
+        const std::optional<edge_property_type> & property =
+                this->edge_properties[this->edge_index(edge)];
+
+        if(!property)
+            throw std::out_of_range("Property not found for edge");
+
+        return *property;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>
+            csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::reversed()
+                    const
+    {
+        csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty> result;
+
+        result.vertices_ = this->vertices_;
+        result.indices = this->indices;
+        result.vertex_properties = this->vertex_properties;
+        result.edge_properties = this->edge_properties;
+        std::transform(this->edges_.begin(), this->edges_.end(), std::back_inserter(result.edges_),
+                [](auto && edge) { return edge.reversed(); });
+        result.build_rows(true);
+        return result;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    void csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::build_rows(
+            bool directed)
+    {
+        std::vector<std::pair<size_t, size_t>> endpoints;
+
+        std::transform(this->edges_.begin(), this->edges_.end(), std::back_inserter(endpoints),
+                [&](auto && edge)
+                {
+                    return std::make_pair(this->indices.at(edge.source()),
+                            this->indices.at(edge.destination()));
+                });
+
+        pack_rows(this->vertices_.size(), endpoints, !directed, this->offsets,
+                this->neighbour_indices, this->edge_indices);
+
+        if(directed)
+        {
+            std::for_each(endpoints.begin(), endpoints.end(),
+                    [](auto && endpoint) { std::swap(endpoint.first, endpoint.second); });
+            pack_rows(this->vertices_.size(), endpoints, false, this->input_offsets,
+                    this->input_neighbour_indices, this->input_edge_indices);
+        }
+        else
+        {
+            this->input_offsets = this->offsets;
+            this->input_neighbour_indices.clear();
+            this->input_edge_indices.clear();
+        }
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    std::optional<size_t>
+            csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::find_edge(
+                    size_t source_index,
+                    size_t destination_index) const
+    {
+        auto row_begin = this->neighbour_indices.begin() + this->offsets[source_index];
+        auto row_end = this->neighbour_indices.begin() + this->offsets[source_index + 1];
+        auto it = std::lower_bound(row_begin, row_end, destination_index);
+
+        if(it == row_end || *it != destination_index)
+            return std::nullopt;
+
+        return std::make_optional(this->edge_indices[it - this->neighbour_indices.begin()]);
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    size_t csr_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::edge_index(
+            const edge_type & edge) const
+    {
+        auto source_it = this->indices.find(edge.source());
+        auto destination_it = this->indices.find(edge.destination());
+
+        if(source_it != this->indices.end() && destination_it != this->indices.end())
+        {
+            std::optional<size_t> edge_index =
+                    this->find_edge(source_it->second, destination_it->second);
+
+            if(edge_index && this->edges_[*edge_index] == edge)
+                return *edge_index;
+        }
+
+        throw std::invalid_argument("Edge does not belong to the graph");
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    std::shared_ptr<const std::vector<double>> csr_representation<VertexId,
+            Vertex,
+            Edge,
+            VertexProperty,
+            EdgeProperty>::weights_column() const
+    {
+        std::shared_ptr<const std::vector<double>> column = std::atomic_load(&this->weights);
+
+        if(column)
+            return column;
+
+        std::shared_ptr<std::vector<double>> new_column = std::make_shared<std::vector<double>>();
+
+        new_column->reserve(this->edge_indices.size());
+
+        for(size_t edge_index : this->edge_indices)
+            new_column->push_back(this->edge_properties[edge_index]
+                                          ? this->edge_properties[edge_index]->weight()
+                                          : std::numeric_limits<double>::quiet_NaN());
+
+        // concurrent readers may build the column twice, but always with the same weights
+        std::atomic_store(&this->weights, std::shared_ptr<const std::vector<double>>(new_column));
+        return new_column;
+    }
+}
+
+namespace algolib::graphs
+{
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    class frozen_graph : public virtual graph<VertexId, VertexProperty, EdgeProperty>
+    {
+    public:
+        using vertex_id_type =
+                typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_id_type;
+        using vertex_type = typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type;
+        using edge_type = typename graph<VertexId, VertexProperty, EdgeProperty>::edge_type;
+        using vertex_property_type =
+                typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_property_type;
+        using edge_property_type =
+                typename graph<VertexId, VertexProperty, EdgeProperty>::edge_property_type;
+
+    protected:
+        using repr = internal::csr_representation<vertex_id_type,
+                vertex_type,
+                edge_type,
+                vertex_property_type,
+                edge_property_type>;
+
+    private:
+        class graph_properties_impl;
+
+    public:
+        ~frozen_graph() override = default;
+
+        frozen_graph(const frozen_graph & graph)
+            : representation{graph.representation}, graph_properties_{*this}
+        {
+        }
+
+        frozen_graph(frozen_graph && graph)
+            : representation{std::move(graph.representation)}, graph_properties_{*this}
+        {
+        }
+
+        frozen_graph & operator=(const frozen_graph & graph)
+        {
+            // properties keep referring to this graph
+            representation = graph.representation;
+            return *this;
+        }
+
+        frozen_graph & operator=(frozen_graph && graph)
+        {
+            representation = std::move(graph.representation);
+            return *this;
+        }
+
+        typename graph<VertexId, VertexProperty, EdgeProperty>::graph_properties &
+                properties() override
+        {
+            return this->graph_properties_;
+        }
+
+        const typename graph<VertexId, VertexProperty, EdgeProperty>::graph_properties &
+                properties() const override
+        {
+            return this->graph_properties_;
+        }
+
+        const vertex_type & operator[](const vertex_id_type & vertex_id) const override
+        {
+            return this->representation[vertex_id];
+        }
+
+        const edge_type & operator[](
+                const std::pair<vertex_id_type, vertex_id_type> & vertex_ids) const override
+        {
+            return this->representation[vertex_ids];
+        }
+
+        const edge_type & operator[](
+                const std::pair<vertex_type, vertex_type> & vertices) const override
+        {
+            return this->representation[std::make_pair(vertices.first.id(), vertices.second.id())];
+        }
+
+        size_t vertices_count() const override
+        {
+            return this->representation.size();
+        }
+
+        size_t edges_count() const override
+        {
+            return this->representation.edges_count();
+        }
+
+        std::vector<vertex_type> vertices() const override
+        {
+            return this->representation.vertices();
+        }
+
+        std::vector<edge_type> edges() const override
+        {
+            return this->representation.edges();
+        }
+
+        std::vector<edge_type> adjacent_edges(const vertex_type & vertex) const override
+        {
+            return this->representation.adjacent_edges(vertex);
+        }
+
+        std::vector<vertex_type> neighbours(const vertex_type & vertex) const override
+        {
+            return this->representation.neighbours(vertex);
+        }
+
+        void for_each_neighbour(const vertex_type & vertex,
+                internal::function_ref<void(const vertex_type &)> function) const override
+        {
+            this->representation.for_each_neighbour(vertex, function);
+        }
+
+        bool any_neighbour(const vertex_type & vertex,
+                internal::function_ref<bool(const vertex_type &)> function) const override
+        {
+            return this->representation.any_neighbour(vertex, function);
+        }
+
+        void for_each_adjacent_edge(const vertex_type & vertex,
+                internal::function_ref<void(const edge_type &)> function) const override
+        {
+            this->representation.for_each_adjacent_edge(vertex, function);
+        }
+
+        void for_each_weighted_edge(const vertex_type & vertex,
+                internal::function_ref<void(const edge_type &, double)> function) const override
+        {
+            if constexpr(std::is_base_of_v<weighted, edge_property_type>)
+                this->representation.for_each_weighted_edge(vertex, function);
+            else
+                graph<VertexId, VertexProperty, EdgeProperty>::for_each_weighted_edge(
+                        vertex, function);
+        }
+
+        void for_each_indexed_weighted_edge(size_t index,
+                internal::function_ref<void(size_t, const vertex_type &, double)> function)
+                const override
+        {
+            if constexpr(std::is_base_of_v<weighted, edge_property_type>)
+                this->representation.for_each_indexed_weighted_edge(index, function);
+            else
+                throw std::logic_error("Edge properties are not weighted");
+        }
+
+        bool is_indexed() const override
+        {
+            return true;
+        }
+
+        size_t output_degree(const vertex_type & vertex) const override
+        {
+            return this->representation.degree(this->representation.index(vertex));
+        }
+
+        /*!
+         * \brief Gets the index of given vertex in this graph.
+         * Vertices are indexed with consecutive numbers from zero in order of their identifiers.
+         * \param vertex the vertex from this graph
+         * \return the index of the vertex
+         * \throw std::invalid_argument if the vertex does not belong to this graph
+         */
+        size_t index(const vertex_type & vertex) const override
+        {
+            return this->representation.index(vertex);
+        }
+
+        /*!
+         * \brief Gets indices of neighbours of the vertex at given index.
+         * \param index the index of the vertex
+         * \return the range of indices of neighbours in increasing order
+         */
+        std::pair<const size_t *, const size_t *> neighbour_indices(size_t index) const
+        {
+            return this->representation.neighbour_row(index);
+        }
+
+        /*!
+         * \brief Gets indices of vertices with edges to the vertex at given index.
+         * In undirected graphs these are the neighbours of the vertex.
+         * \param index the index of the vertex
+         * \return the range of indices of predecessors in increasing order
+         */
+        std::pair<const size_t *, const size_t *> predecessor_indices(size_t index) const
+        {
+            return this->representation.input_row(index);
+        }
+
+    protected:
+        explicit frozen_graph(repr representation)
+            : representation{std::move(representation)}, graph_properties_{*this}
+        {
+        }
+
+        repr representation;
+
+    private:
+        graph_properties_impl graph_properties_;
+    };
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    class frozen_graph<VertexId, VertexProperty, EdgeProperty>::graph_properties_impl
+        : public virtual graph<VertexId, VertexProperty, EdgeProperty>::graph_properties
+    {
+    public:
+        explicit graph_properties_impl(frozen_graph<VertexId, VertexProperty, EdgeProperty> & graph)
+            : graph{graph}
+        {
+        }
+
+        vertex_property_type & operator[](const vertex_type & vertex) override
+        {
+            return graph.representation.property(vertex);
+        }
+
+        vertex_property_type & at(const vertex_type & vertex) override
+        {
+            return graph.representation.property_at(vertex);
+        }
+
+        const vertex_property_type & at(const vertex_type & vertex) const override
+        {
+            return std::as_const(graph.representation).property_at(vertex);
+        }
+
+        edge_property_type & operator[](const edge_type & edge) override
+        {
+            return graph.representation.property(edge);
+        }
+
+        edge_property_type & at(const edge_type & edge) override
+        {
+            return graph.representation.property_at(edge);
+        }
+
+        const edge_property_type & at(const edge_type & edge) const override
+        {
+            return std::as_const(graph.representation).property_at(edge);
+        }
+
+    private:
+        frozen_graph<VertexId, VertexProperty, EdgeProperty> & graph;
+    };
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    class directed_frozen_graph
+        : public frozen_graph<VertexId, VertexProperty, EdgeProperty>,
+          public virtual directed_graph<VertexId, VertexProperty, EdgeProperty>
+    {
+    public:
+        using vertex_id_type =
+                typename frozen_graph<VertexId, VertexProperty, EdgeProperty>::vertex_id_type;
+        using vertex_type =
+                typename frozen_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type;
+        using edge_type = typename frozen_graph<VertexId, VertexProperty, EdgeProperty>::edge_type;
+        using vertex_property_type =
+                typename frozen_graph<VertexId, VertexProperty, EdgeProperty>::vertex_property_type;
+        using edge_property_type =
+                typename frozen_graph<VertexId, VertexProperty, EdgeProperty>::edge_property_type;
+
+    protected:
+        using repr = typename frozen_graph<VertexId, VertexProperty, EdgeProperty>::repr;
+
+    public:
+        /*!
+         * \brief Creates the graph from given representation of simple graph.
+         * Use directed_simple_graph::freeze to obtain a frozen graph.
+         * \param representation the representation of directed simple graph
+         */
+        explicit directed_frozen_graph(const typename repr::source_type & representation)
+            : frozen_graph<VertexId, VertexProperty, EdgeProperty>(repr(representation, true))
+        {
+        }
+
+        ~directed_frozen_graph() override = default;
+        directed_frozen_graph(const directed_frozen_graph &) = default;
+        directed_frozen_graph(directed_frozen_graph &&) = default;
+        directed_frozen_graph & operator=(const directed_frozen_graph &) = default;
+        directed_frozen_graph & operator=(directed_frozen_graph &&) = default;
+
+        size_t input_degree(const vertex_type & vertex) const override
+        {
+            return this->representation.input_degree(this->representation.index(vertex));
+        }
+
+        bool indexes_incoming() const override
+        {
+            return true;
+        }
+
+        std::vector<vertex_type> predecessors(const vertex_type & vertex) const override
+        {
+            return this->representation.predecessors(vertex);
+        }
+
+        std::vector<edge_type> incoming_edges(const vertex_type & vertex) const override
+        {
+            return this->representation.incoming_edges(vertex);
+        }
+
+        void for_each_incoming_edge(const vertex_type & vertex,
+                internal::function_ref<void(const edge_type &)> function) const override
+        {
+            this->representation.for_each_incoming_edge(vertex, function);
+        }
+
+        void for_each_incoming_weighted_edge(const vertex_type & vertex,
+                internal::function_ref<void(const edge_type &, double)> function) const override
+        {
+            if constexpr(std::is_base_of_v<weighted, edge_property_type>)
+                this->representation.for_each_incoming_weighted_edge(vertex, function);
+            else
+                directed_graph<VertexId, VertexProperty, EdgeProperty>::
+                        for_each_incoming_weighted_edge(vertex, function);
+        }
+
+        void for_each_incoming_indexed_weighted_edge(size_t index,
+                internal::function_ref<void(size_t, const vertex_type &, double)> function)
+                const override
+        {
+            if constexpr(std::is_base_of_v<weighted, edge_property_type>)
+                this->representation.for_each_incoming_indexed_weighted_edge(index, function);
+            else
+                throw std::logic_error("Edge properties are not weighted");
+        }
+
+        void reverse() override
+        {
+            this->representation = this->representation.reversed();
+        }
+
+        /*!
+         * \brief Returns reversed copy of this graph.
+         * \return the copy of this graph with reversed directions of all edges
+         */
+        directed_frozen_graph<vertex_id_type, vertex_property_type, edge_property_type>
+                reversed_copy() const
+        {
+            directed_frozen_graph<vertex_id_type, vertex_property_type, edge_property_type>
+                    reversed_graph = *this;
+
+            reversed_graph.reverse();
+            return reversed_graph;
+        }
+    };
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    class undirected_frozen_graph
+        : public frozen_graph<VertexId, VertexProperty, EdgeProperty>,
+          public virtual undirected_graph<VertexId, VertexProperty, EdgeProperty>
+    {
+    public:
+        using vertex_id_type =
+                typename frozen_graph<VertexId, VertexProperty, EdgeProperty>::vertex_id_type;
+        using vertex_type =
+                typename frozen_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type;
+        using edge_type = typename frozen_graph<VertexId, VertexProperty, EdgeProperty>::edge_type;
+        using vertex_property_type =
+                typename frozen_graph<VertexId, VertexProperty, EdgeProperty>::vertex_property_type;
+        using edge_property_type =
+                typename frozen_graph<VertexId, VertexProperty, EdgeProperty>::edge_property_type;
+
+    protected:
+        using repr = typename frozen_graph<VertexId, VertexProperty, EdgeProperty>::repr;
+
+    public:
+        /*!
+         * \brief Creates the graph from given representation of simple graph.
+         * Use undirected_simple_graph::freeze to obtain a frozen graph.
+         * \param representation the representation of undirected simple graph
+         */
+        explicit undirected_frozen_graph(const typename repr::source_type & representation)
+            : frozen_graph<VertexId, VertexProperty, EdgeProperty>(repr(representation, false))
+        {
+        }
+
+        ~undirected_frozen_graph() override = default;
+        undirected_frozen_graph(const undirected_frozen_graph &) = default;
+        undirected_frozen_graph(undirected_frozen_graph &&) = default;
+        undirected_frozen_graph & operator=(const undirected_frozen_graph &) = default;
+        undirected_frozen_graph & operator=(undirected_frozen_graph &&) = default;
+
+        size_t input_degree(const vertex_type & vertex) const override
+        {
+            return this->output_degree(vertex);
+        }
+    };
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    directed_frozen_graph<VertexId, VertexProperty, EdgeProperty>
+            directed_simple_graph<VertexId, VertexProperty, EdgeProperty>::freeze() const
+    {
+        return directed_frozen_graph<VertexId, VertexProperty, EdgeProperty>(this->representation);
+    }
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    undirected_frozen_graph<VertexId, VertexProperty, EdgeProperty>
+            undirected_simple_graph<VertexId, VertexProperty, EdgeProperty>::freeze() const
+    {
+        return undirected_frozen_graph<VertexId, VertexProperty, EdgeProperty>(
+                this->representation);
+    }
+}
+
+#endif
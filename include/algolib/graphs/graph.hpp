@@ -5,10 +5,50 @@
 #ifndef GRAPH_HPP_
 #define GRAPH_HPP_
 
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include "algolib/graphs/edge.hpp"
+#include "algolib/graphs/properties.hpp"
 #include "algolib/graphs/vertex.hpp"
 
+namespace internal
+{
+    template <typename Signature>
+    class function_ref;
+
+    // Non-owning reference to a callable, passed through virtual functions without allocation.
+    template <typename Result, typename... Args>
+    class function_ref<Result(Args...)>
+    {
+    public:
+        template <typename Function,
+                typename = std::enable_if_t<
+                        !std::is_same_v<std::decay_t<Function>, function_ref>>>
+        function_ref(Function && function)
+            : callable{const_cast<void *>(static_cast<const void *>(std::addressof(function)))},
+              invoker{[](void * callable, Args... args) -> Result
+                      {
+                          return static_cast<Result>(
+                                  (*static_cast<std::remove_reference_t<Function> *>(callable))(
+                                          std::forward<Args>(args)...));
+                      }}
+        {
+        }
+
+        Result operator()(Args... args) const
+        {
+            return this->invoker(this->callable, std::forward<Args>(args)...);
+        }
+
+    private:
+        void * callable;
+        Result (*invoker)(void *, Args...);
+    };
+}
+
 namespace algolib::graphs
 {
     template <typename VertexId, typename VertexProperty, typename EdgeProperty>
@@ -92,6 +132,57 @@ namespace algolib::graphs
          */
         virtual std::vector<edge<VertexId>> adjacent_edges(const vertex_type & vertex) const = 0;
 
+        /*!
+         * \brief Calls given function on each neighbour of given vertex without copying them.
+         * \param vertex the vertex from this graph
+         * \param function the function to call
+         */
+        virtual void for_each_neighbour(const vertex_type & vertex,
+                internal::function_ref<void(const vertex_type &)> function) const = 0;
+
+        /*!
+         * \brief Calls given function on neighbours of given vertex until it returns \c true.
+         * \param vertex the vertex from this graph
+         * \param function the function to call
+         * \return \c true if the function returned \c true for any neighbour, otherwise \c false
+         */
+        virtual bool any_neighbour(const vertex_type & vertex,
+                internal::function_ref<bool(const vertex_type &)> function) const
+        {
+            for(auto && neighbour : this->neighbours(vertex))
+                if(function(neighbour))
+                    return true;
+
+            return false;
+        }
+
+        /*!
+         * \brief Calls given function on each adjacent edge of given vertex without copying them.
+         * \param vertex the vertex from this graph
+         * \param function the function to call
+         */
+        virtual void for_each_adjacent_edge(const vertex_type & vertex,
+                internal::function_ref<void(const edge_type &)> function) const = 0;
+
+        /*!
+         * \brief Calls given function on each adjacent edge of given vertex and its weight.
+         * Graphs with columnar properties read the weights sequentially without edge lookups.
+         * \param vertex the vertex from this graph
+         * \param function the function to call
+         * \throw std::out_of_range if an adjacent edge has no property
+         * \throw std::logic_error if edge properties are not weighted
+         */
+        virtual void for_each_weighted_edge(const vertex_type & vertex,
+                internal::function_ref<void(const edge_type &, double)> function) const
+        {
+            if constexpr(std::is_base_of_v<weighted, edge_property_type>)
+                this->for_each_adjacent_edge(vertex,
+                        [&](const edge_type & edge)
+                        { function(edge, this->properties().at(edge).weight()); });
+            else
+                throw std::logic_error("Edge properties are not weighted");
+        }
+
         /*!
          * \brief Gets the output degree of given vertex.
          * \param vertex the vertex from the graph
@@ -105,6 +196,52 @@ namespace algolib::graphs
          * \return the input degree of the vertex
          */
         virtual size_t input_degree(const vertex_type & vertex) const = 0;
+
+        /*!
+         * \brief Checks whether vertices of this graph are identified with consecutive numbers
+         * from zero, so algorithms can keep per-vertex state in arrays.
+         * \return \c true if the graph is dense, otherwise \c false
+         */
+        virtual bool is_dense() const
+        {
+            return false;
+        }
+
+        /*!
+         * \brief Checks whether vertices of this graph have indices, consecutive numbers from zero,
+         * so algorithms can follow edges between indices without looking vertices up.
+         * \return \c true if vertices are indexed, otherwise \c false
+         */
+        virtual bool is_indexed() const
+        {
+            return false;
+        }
+
+        /*!
+         * \brief Gets the index of given vertex in this graph with indexed vertices.
+         * \param vertex the vertex from this graph
+         * \return the index of the vertex
+         * \throw std::logic_error if vertices of this graph are not indexed
+         */
+        virtual size_t index(const vertex_type &) const
+        {
+            throw std::logic_error("Vertices are not indexed");
+        }
+
+        /*!
+         * \brief Calls given function on each adjacent edge of the vertex at given index with the
+         * index of its neighbour, the neighbour and the weight of the edge.
+         * \param index the index of the vertex in this graph with indexed vertices
+         * \param function the function to call
+         * \throw std::out_of_range if an adjacent edge has no property
+         * \throw std::logic_error if vertices are not indexed or edge properties are not weighted
+         */
+        virtual void for_each_indexed_weighted_edge(size_t,
+                internal::function_ref<void(size_t, const vertex_type &, double)>) const
+        {
+            if(!this->is_indexed())
+                throw std::logic_error("Vertices are not indexed");
+        }
     };
 
     template <typename VertexId, typename VertexProperty, typename EdgeProperty>
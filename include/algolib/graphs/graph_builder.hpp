@@ -0,0 +1,302 @@
+/*!
+ * \file graph_builder.hpp
+ * \brief Bulk construction of simple graphs.
+ */
+#ifndef GRAPH_BUILDER_HPP_
+#define GRAPH_BUILDER_HPP_
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory_resource>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include "algolib/graphs/directed_graph.hpp"
+#include "algolib/graphs/undirected_graph.hpp"
+
+namespace internal
+{
+    namespace algr = algolib::graphs;
+
+    // Minimal number of elements sorted with more than one thread.
+    constexpr size_t parallel_sort_threshold = 1 << 16;
+
+    // Sorts chunks of the range in separate threads, then merges them pairwise.
+    template <typename RandomIt, typename Compare>
+    void parallel_sort(RandomIt first, RandomIt last, Compare compare, size_t threads_count)
+    {
+        size_t size = last - first;
+
+        if(threads_count <= 1 || size < parallel_sort_threshold)
+        {
+            std::sort(first, last, compare);
+            return;
+        }
+
+        size_t chunk_size = (size + threads_count - 1) / threads_count;
+        std::vector<RandomIt> bounds;
+        std::vector<std::thread> threads;
+
+        for(size_t i = 0; i < size; i += chunk_size)
+            bounds.push_back(first + i);
+
+        bounds.push_back(last);
+
+        for(size_t i = 0; i + 1 < bounds.size(); ++i)
+            threads.emplace_back([&, i]() { std::sort(bounds[i], bounds[i + 1], compare); });
+
+        for(auto && thread : threads)
+            thread.join();
+
+        for(size_t step = 1; step + 1 < bounds.size(); step *= 2)
+        {
+            threads.clear();
+
+            for(size_t i = 0; i + step + 1 < bounds.size(); i += 2 * step)
+                threads.emplace_back(
+                        [&, i, step]()
+                        {
+                            std::inplace_merge(bounds[i], bounds[i + step],
+                                    bounds[std::min(i + 2 * step, bounds.size() - 1)], compare);
+                        });
+
+            for(auto && thread : threads)
+                thread.join();
+        }
+    }
+}
+
+namespace algolib::graphs
+{
+    /*!
+     * \brief Collects vertices and edges and builds a simple graph from them at once.
+     * Repeated edges are added once with the property given first. In undirected graphs edges
+     * between the same vertices in opposite directions count as repeated.
+     * \tparam Graph the type of built graph, either directed_simple_graph or
+     * undirected_simple_graph
+     */
+    template <typename Graph>
+    class graph_builder
+    {
+    public:
+        using graph_type = Graph;
+        using vertex_id_type = typename graph_type::vertex_id_type;
+        using vertex_type = typename graph_type::vertex_type;
+        using edge_type = typename graph_type::edge_type;
+        using edge_property_type = typename graph_type::edge_property_type;
+
+        /*!
+         * \param edges_capacity the expected number of edges
+         * \param threads_count the number of threads used for sorting large inputs
+         */
+        explicit graph_builder(size_t edges_capacity = 0,
+                size_t threads_count = std::thread::hardware_concurrency())
+            : threads_count{threads_count}
+        {
+            this->edges.reserve(edges_capacity);
+            this->properties.reserve(edges_capacity);
+        }
+
+        ~graph_builder() = default;
+        graph_builder(const graph_builder &) = default;
+        graph_builder(graph_builder &&) = default;
+        graph_builder & operator=(const graph_builder &) = default;
+        graph_builder & operator=(graph_builder &&) = default;
+
+        /*!
+         * \brief Adds a vertex with no edges to the built graph.
+         * \param vertex_id the vertex identifier
+         * \return this builder
+         */
+        graph_builder & add_vertex(const vertex_id_type & vertex_id)
+        {
+            this->vertex_ids.push_back(vertex_id);
+            return *this;
+        }
+
+        /*!
+         * \brief Adds an edge between vertices of given identifiers to the built graph.
+         * \param source_id the source vertex identifier
+         * \param destination_id the destination vertex identifier
+         * \return this builder
+         */
+        graph_builder & add_edge(const vertex_id_type & source_id,
+                const vertex_id_type & destination_id)
+        {
+            this->edges.emplace_back(source_id, destination_id);
+            this->properties.emplace_back();
+            return *this;
+        }
+
+        /*!
+         * \brief Adds an edge with property between vertices of given identifiers to the built
+         * graph.
+         * \param source_id the source vertex identifier
+         * \param destination_id the destination vertex identifier
+         * \param property the edge property
+         * \return this builder
+         */
+        graph_builder & add_edge(const vertex_id_type & source_id,
+                const vertex_id_type & destination_id,
+                const edge_property_type & property)
+        {
+            this->edges.emplace_back(source_id, destination_id);
+            this->properties.emplace_back(property);
+            return *this;
+        }
+
+        /*!
+         * \brief Adds edges from given range to the built graph.
+         * Elements are pairs of vertex identifiers or triples of vertex identifiers and edge
+         * property.
+         * \param first the beginning of the range
+         * \param last the end of the range
+         * \return this builder
+         */
+        template <typename InputIt>
+        graph_builder & add_edges(InputIt first, InputIt last);
+
+        /*!
+         * \brief Builds the graph from all collected vertices and edges.
+         * \param resource the memory resource to allocate the graph from
+         * \return the new graph
+         */
+        graph_type build(
+                std::pmr::memory_resource * resource = std::pmr::get_default_resource()) const;
+
+    private:
+        struct edge_entry
+        {
+            vertex_id_type first;
+            vertex_id_type second;
+            size_t index;
+        };
+
+        static constexpr bool directed = std::is_base_of_v<
+                directed_graph<vertex_id_type, typename graph_type::vertex_property_type,
+                        edge_property_type>,
+                graph_type>;
+
+        size_t threads_count;
+        std::vector<vertex_id_type> vertex_ids;
+        std::vector<std::pair<vertex_id_type, vertex_id_type>> edges;
+        std::vector<std::optional<edge_property_type>> properties;
+    };
+
+    template <typename Graph>
+    template <typename InputIt>
+    graph_builder<Graph> & graph_builder<Graph>::add_edges(InputIt first, InputIt last)
+    {
+        using value_type = typename std::iterator_traits<InputIt>::value_type;
+
+        if constexpr(std::is_base_of_v<std::random_access_iterator_tag,
+                             typename std::iterator_traits<InputIt>::iterator_category>)
+        {
+            size_t required = this->edges.size() + (last - first);
+
+            if(required > this->edges.capacity())
+            {
+                this->edges.reserve(std::max(required, 2 * this->edges.capacity()));
+                this->properties.reserve(std::max(required, 2 * this->properties.capacity()));
+            }
+        }
+
+        for(; first != last; ++first)
+            if constexpr(std::tuple_size_v<value_type> > 2)
+                this->add_edge(std::get<0>(*first), std::get<1>(*first), std::get<2>(*first));
+            else
+                this->add_edge(std::get<0>(*first), std::get<1>(*first));
+
+        return *this;
+    }
+
+    template <typename Graph>
+    typename graph_builder<Graph>::graph_type graph_builder<Graph>::build(
+            std::pmr::memory_resource * resource) const
+    {
+        std::vector<vertex_id_type> all_vertex_ids = this->vertex_ids;
+        std::vector<edge_entry> entries;
+
+        all_vertex_ids.reserve(all_vertex_ids.size() + 2 * this->edges.size());
+        entries.reserve(this->edges.size());
+
+        for(size_t i = 0; i < this->edges.size(); ++i)
+        {
+            const vertex_id_type & source_id = this->edges[i].first;
+            const vertex_id_type & destination_id = this->edges[i].second;
+
+            all_vertex_ids.push_back(source_id);
+            all_vertex_ids.push_back(destination_id);
+
+            // undirected edges are compared regardless of their direction
+            if(!directed && destination_id < source_id)
+                entries.push_back(edge_entry{destination_id, source_id, i});
+            else
+                entries.push_back(edge_entry{source_id, destination_id, i});
+        }
+
+        internal::parallel_sort(all_vertex_ids.begin(), all_vertex_ids.end(),
+                std::less<vertex_id_type>(), this->threads_count);
+        all_vertex_ids.erase(std::unique(all_vertex_ids.begin(), all_vertex_ids.end()),
+                all_vertex_ids.end());
+
+        // ties are broken by index, so the first added of repeated edges is kept
+        internal::parallel_sort(entries.begin(), entries.end(),
+                [](const edge_entry & entry1, const edge_entry & entry2)
+                {
+                    return std::tie(entry1.first, entry1.second, entry1.index)
+                           < std::tie(entry2.first, entry2.second, entry2.index);
+                },
+                this->threads_count);
+        entries.erase(std::unique(entries.begin(), entries.end(),
+                              [](const edge_entry & entry1, const edge_entry & entry2)
+                              {
+                                  return entry1.first == entry2.first
+                                         && entry1.second == entry2.second;
+                              }),
+                entries.end());
+
+        graph_type graph(all_vertex_ids, resource);
+        std::vector<size_t> degrees(all_vertex_ids.size());
+        auto position = [&](const vertex_id_type & vertex_id)
+        {
+            return std::lower_bound(all_vertex_ids.begin(), all_vertex_ids.end(), vertex_id)
+                   - all_vertex_ids.begin();
+        };
+
+        for(auto && entry : entries)
+        {
+            ++degrees[position(entry.first)];
+
+            // undirected edge is kept by both its vertices, but a loop only once
+            if(!directed && entry.first != entry.second)
+                ++degrees[position(entry.second)];
+        }
+
+        for(size_t i = 0; i < all_vertex_ids.size(); ++i)
+            graph.representation.reserve_edges(vertex_type(all_vertex_ids[i]), degrees[i]);
+
+        // entries are unique and all their vertices are in the graph, so nothing is checked
+        for(auto && entry : entries)
+        {
+            edge_type edge(vertex_type(this->edges[entry.index].first),
+                    vertex_type(this->edges[entry.index].second));
+
+            graph.representation.add_edge_unchecked(
+                    edge, !directed && entry.first != entry.second);
+
+            if(this->properties[entry.index])
+                graph.representation.set_property_unchecked(edge, *this->properties[entry.index]);
+
+            if constexpr(!directed)
+                graph.edge_list.push_back(edge);
+        }
+
+        return graph;
+    }
+}
+
+#endif
@@ -0,0 +1,1010 @@
+/*!
+ * \file mapped_graph.hpp
+ * \brief Structure of read-only graph memory-mapped from binary file.
+ */
+#ifndef MAPPED_GRAPH_HPP_
+#define MAPPED_GRAPH_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "algolib/graphs/directed_graph.hpp"
+#include "algolib/graphs/frozen_graph.hpp"
+#include "algolib/graphs/graph.hpp"
+#include "algolib/graphs/properties.hpp"
+#include "algolib/graphs/undirected_graph.hpp"
+
+namespace internal
+{
+    namespace algr = algolib::graphs;
+
+    static_assert(sizeof(size_t) == sizeof(std::uint64_t), "Graph files need 64-bit sizes");
+
+    constexpr char graph_file_magic[8] = {'A', 'L', 'G', 'R', 'A', 'P', 'H', '\0'};
+    constexpr std::uint64_t graph_file_byte_order = 0x0102030405060708;
+    constexpr std::uint32_t graph_file_version = 2;
+    constexpr std::uint32_t graph_file_directed = 1;
+    constexpr std::uint32_t graph_file_weighted = 2;
+
+    /*
+     * Graph file starts with this header, followed by arrays of vertices, edges, offsets,
+     * neighbour indices and edge indices of rows, then the same three arrays of incoming rows
+     * for directed graphs, then edge weights for weighted graphs. Every array is aligned to
+     * 64 bytes and stored in the byte order of the writing machine, which is recorded in the
+     * header as a fixed marker.
+     */
+    struct graph_file_header
+    {
+        char magic[8];
+        std::uint64_t byte_order;
+        std::uint32_t version;
+        std::uint32_t flags;
+        std::uint64_t vertex_size;
+        std::uint64_t edge_size;
+        std::uint64_t vertices_count;
+        std::uint64_t edges_count;
+        std::uint64_t rows_size;
+        std::uint64_t input_rows_size;
+    };
+
+    // Positions of arrays in graph file described by the header.
+    struct graph_file_layout
+    {
+        explicit graph_file_layout(const graph_file_header & header);
+
+        size_t vertices;
+        size_t edges;
+        size_t offsets;
+        size_t neighbour_indices;
+        size_t edge_indices;
+        size_t input_offsets;
+        size_t input_neighbour_indices;
+        size_t input_edge_indices;
+        size_t weights;
+        size_t size;
+    };
+
+    // Whole file mapped read-only into memory.
+    class mapped_file
+    {
+    public:
+        explicit mapped_file(const std::string & path);
+        ~mapped_file();
+        mapped_file(const mapped_file &) = delete;
+        mapped_file(mapped_file &&) = delete;
+        mapped_file & operator=(const mapped_file &) = delete;
+        mapped_file & operator=(mapped_file &&) = delete;
+
+        const char * data() const
+        {
+            return this->data_;
+        }
+
+        size_t size() const
+        {
+            return this->size_;
+        }
+
+    private:
+        const char * data_;
+        size_t size_;
+    };
+
+    // Arrays of graph pointing directly into mapped file.
+    template <typename Vertex, typename Edge>
+    struct mapped_csr
+    {
+        std::shared_ptr<mapped_file> file;
+        size_t vertices_count;
+        size_t edges_count;
+        const Vertex * vertices;
+        const Edge * edges;
+        const size_t * offsets;
+        const size_t * neighbour_indices;
+        const size_t * edge_indices;
+        const size_t * input_offsets;
+        const size_t * input_neighbour_indices;
+        const size_t * input_edge_indices;
+        const double * weights;
+    };
+
+    template <typename Vertex, typename Edge>
+    mapped_csr<Vertex, Edge> map_graph_file(const std::string & path, bool directed)
+    {
+        static_assert(std::is_trivially_copyable_v<Vertex> && std::is_trivially_copyable_v<Edge>,
+                "Vertex identifiers in graph files must be trivially copyable");
+
+        mapped_csr<Vertex, Edge> csr;
+        graph_file_header header;
+
+        csr.file = std::make_shared<mapped_file>(path);
+
+        if(csr.file->size() < sizeof(graph_file_header))
+            throw std::runtime_error("Graph file is too short");
+
+        std::memcpy(&header, csr.file->data(), sizeof(graph_file_header));
+
+        if(std::memcmp(header.magic, graph_file_magic, sizeof(graph_file_magic)) != 0)
+            throw std::runtime_error("File is not a graph file");
+
+        if(header.byte_order != graph_file_byte_order)
+            throw std::runtime_error("Graph file has different byte order");
+
+        if(header.version != graph_file_version)
+            throw std::runtime_error("Unsupported graph file version");
+
+        if(((header.flags & graph_file_directed) != 0) != directed)
+            throw std::runtime_error("Graph file has different direction of edges");
+
+        if(header.vertex_size != sizeof(Vertex) || header.edge_size != sizeof(Edge))
+            throw std::runtime_error("Graph file has different type of vertex identifiers");
+
+        graph_file_layout layout(header);
+
+        if(csr.file->size() < layout.size)
+            throw std::runtime_error("Graph file is too short");
+
+        const char * data = csr.file->data();
+
+        csr.vertices_count = header.vertices_count;
+        csr.edges_count = header.edges_count;
+        csr.vertices = reinterpret_cast<const Vertex *>(data + layout.vertices);
+        csr.edges = reinterpret_cast<const Edge *>(data + layout.edges);
+        csr.offsets = reinterpret_cast<const size_t *>(data + layout.offsets);
+        csr.neighbour_indices = reinterpret_cast<const size_t *>(data + layout.neighbour_indices);
+        csr.edge_indices = reinterpret_cast<const size_t *>(data + layout.edge_indices);
+        csr.input_offsets = directed ? reinterpret_cast<const size_t *>(data + layout.input_offsets)
+                                     : csr.offsets;
+        csr.input_neighbour_indices =
+                reinterpret_cast<const size_t *>(data + layout.input_neighbour_indices);
+        csr.input_edge_indices =
+                reinterpret_cast<const size_t *>(data + layout.input_edge_indices);
+        csr.weights = (header.flags & graph_file_weighted) != 0
+                              ? reinterpret_cast<const double *>(data + layout.weights)
+                              : nullptr;
+        return csr;
+    }
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    void write_graph_file(const algr::graph<VertexId, VertexProperty, EdgeProperty> & graph,
+            bool directed,
+            const std::string & path)
+    {
+        using vertex_type =
+                typename algr::graph<VertexId, VertexProperty, EdgeProperty>::vertex_type;
+        using edge_type = typename algr::graph<VertexId, VertexProperty, EdgeProperty>::edge_type;
+
+        static_assert(std::is_trivially_copyable_v<vertex_type>
+                              && std::is_trivially_copyable_v<edge_type>,
+                "Vertex identifiers in graph files must be trivially copyable");
+
+        std::vector<vertex_type> vertices = graph.vertices();
+        std::vector<edge_type> edges = graph.edges();
+        std::vector<std::pair<size_t, size_t>> endpoints;
+        std::vector<size_t> offsets, neighbour_indices, edge_indices;
+        std::vector<size_t> input_offsets, input_neighbour_indices, input_edge_indices;
+        std::vector<double> weights;
+        graph_file_header header;
+
+        std::sort(vertices.begin(), vertices.end());
+        std::sort(edges.begin(), edges.end());
+
+        auto index = [&](const vertex_type & vertex)
+        { return std::lower_bound(vertices.begin(), vertices.end(), vertex) - vertices.begin(); };
+
+        std::transform(edges.begin(), edges.end(), std::back_inserter(endpoints),
+                [&](auto && edge)
+                { return std::make_pair(index(edge.source()), index(edge.destination())); });
+        pack_rows(vertices.size(), endpoints, !directed, offsets, neighbour_indices, edge_indices);
+
+        if(directed)
+        {
+            std::for_each(endpoints.begin(), endpoints.end(),
+                    [](auto && endpoint) { std::swap(endpoint.first, endpoint.second); });
+            pack_rows(vertices.size(), endpoints, false, input_offsets, input_neighbour_indices,
+                    input_edge_indices);
+        }
+
+        std::memcpy(header.magic, graph_file_magic, sizeof(graph_file_magic));
+        header.byte_order = graph_file_byte_order;
+        header.version = graph_file_version;
+        header.flags = directed ? graph_file_directed : 0;
+        header.vertex_size = sizeof(vertex_type);
+        header.edge_size = sizeof(edge_type);
+        header.vertices_count = vertices.size();
+        header.edges_count = edges.size();
+        header.rows_size = neighbour_indices.size();
+        header.input_rows_size = input_neighbour_indices.size();
+
+        if constexpr(std::is_base_of_v<algr::weighted, EdgeProperty>)
+        {
+            header.flags |= graph_file_weighted;
+
+            // edges without property are marked with NaN weight
+            for(auto && edge : edges)
+                try
+                {
+                    weights.push_back(graph.properties().at(edge).weight());
+                }
+                catch(const std::out_of_range &)
+                {
+                    weights.push_back(std::numeric_limits<double>::quiet_NaN());
+                }
+        }
+
+        graph_file_layout layout(header);
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+        if(!file)
+            throw std::runtime_error("Cannot open graph file for writing");
+
+        auto write_at = [&](size_t position, const void * data, size_t bytes)
+        {
+            static const char padding[64] = {};
+
+            for(size_t written = file.tellp(); written < position;
+                    written += std::min<size_t>(position - written, sizeof(padding)))
+                file.write(padding, std::min<size_t>(position - written, sizeof(padding)));
+
+            file.write(static_cast<const char *>(data), bytes);
+        };
+
+        write_at(0, &header, sizeof(header));
+        write_at(layout.vertices, vertices.data(), vertices.size() * sizeof(vertex_type));
+        write_at(layout.edges, edges.data(), edges.size() * sizeof(edge_type));
+        write_at(layout.offsets, offsets.data(), offsets.size() * sizeof(size_t));
+        write_at(layout.neighbour_indices, neighbour_indices.data(),
+                neighbour_indices.size() * sizeof(size_t));
+        write_at(layout.edge_indices, edge_indices.data(), edge_indices.size() * sizeof(size_t));
+        write_at(layout.input_offsets, input_offsets.data(), input_offsets.size() * sizeof(size_t));
+        write_at(layout.input_neighbour_indices, input_neighbour_indices.data(),
+                input_neighbour_indices.size() * sizeof(size_t));
+        write_at(layout.input_edge_indices, input_edge_indices.data(),
+                input_edge_indices.size() * sizeof(size_t));
+        write_at(layout.weights, weights.data(), weights.size() * sizeof(double));
+        write_at(layout.size, nullptr, 0);
+
+        if(!file)
+            throw std::runtime_error("Cannot write graph file");
+    }
+}
+
+namespace algolib::graphs
+{
+    /*!
+     * \brief Writes given directed graph to binary graph file.
+     * Weights of edges are written when edge properties are weighted.
+     * \param graph the directed graph
+     * \param path the path of the file
+     * \throw std::runtime_error if the file cannot be written
+     */
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    void write_graph(const directed_graph<VertexId, VertexProperty, EdgeProperty> & graph,
+            const std::string & path)
+    {
+        internal::write_graph_file(graph, true, path);
+    }
+
+    /*!
+     * \brief Writes given undirected graph to binary graph file.
+     * Weights of edges are written when edge properties are weighted.
+     * \param graph the undirected graph
+     * \param path the path of the file
+     * \throw std::runtime_error if the file cannot be written
+     */
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    void write_graph(const undirected_graph<VertexId, VertexProperty, EdgeProperty> & graph,
+            const std::string & path)
+    {
+        internal::write_graph_file(graph, false, path);
+    }
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    class mapped_graph : public virtual graph<VertexId, VertexProperty, EdgeProperty>
+    {
+    public:
+        using vertex_id_type =
+                typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_id_type;
+        using vertex_type = typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_type;
+        using edge_type = typename graph<VertexId, VertexProperty, EdgeProperty>::edge_type;
+        using vertex_property_type =
+                typename graph<VertexId, VertexProperty, EdgeProperty>::vertex_property_type;
+        using edge_property_type =
+                typename graph<VertexId, VertexProperty, EdgeProperty>::edge_property_type;
+
+    private:
+        class graph_properties_impl;
+
+    public:
+        ~mapped_graph() override = default;
+
+        mapped_graph(const mapped_graph & graph)
+            : csr{graph.csr},
+              vertex_properties{graph.vertex_properties},
+              edge_properties{graph.edge_properties},
+              file_edge_properties{std::atomic_load(&graph.file_edge_properties)},
+              edge_properties_written{graph.edge_properties_written},
+              graph_properties_{*this}
+        {
+        }
+
+        mapped_graph(mapped_graph && graph)
+            : csr{std::move(graph.csr)},
+              vertex_properties{std::move(graph.vertex_properties)},
+              edge_properties{std::move(graph.edge_properties)},
+              file_edge_properties{std::move(graph.file_edge_properties)},
+              edge_properties_written{graph.edge_properties_written},
+              graph_properties_{*this}
+        {
+        }
+
+        mapped_graph & operator=(const mapped_graph & graph)
+        {
+            // properties keep referring to this graph
+            csr = graph.csr;
+            vertex_properties = graph.vertex_properties;
+            edge_properties = graph.edge_properties;
+            file_edge_properties = std::atomic_load(&graph.file_edge_properties);
+            edge_properties_written = graph.edge_properties_written;
+            return *this;
+        }
+
+        mapped_graph & operator=(mapped_graph && graph)
+        {
+            csr = std::move(graph.csr);
+            vertex_properties = std::move(graph.vertex_properties);
+            edge_properties = std::move(graph.edge_properties);
+            file_edge_properties = std::move(graph.file_edge_properties);
+            edge_properties_written = graph.edge_properties_written;
+            return *this;
+        }
+
+        typename graph<VertexId, VertexProperty, EdgeProperty>::graph_properties &
+                properties() override
+        {
+            return this->graph_properties_;
+        }
+
+        const typename graph<VertexId, VertexProperty, EdgeProperty>::graph_properties &
+                properties() const override
+        {
+            return this->graph_properties_;
+        }
+
+        const vertex_type & operator[](const vertex_id_type & vertex_id) const override;
+
+        const edge_type & operator[](
+                const std::pair<vertex_id_type, vertex_id_type> & vertex_ids) const override;
+
+        const edge_type & operator[](
+                const std::pair<vertex_type, vertex_type> & vertices) const override
+        {
+            return this->operator[](std::make_pair(vertices.first.id(), vertices.second.id()));
+        }
+
+        size_t vertices_count() const override
+        {
+            return this->csr.vertices_count;
+        }
+
+        size_t edges_count() const override
+        {
+            return this->csr.edges_count;
+        }
+
+        std::vector<vertex_type> vertices() const override
+        {
+            return std::vector<vertex_type>(
+                    this->csr.vertices, this->csr.vertices + this->csr.vertices_count);
+        }
+
+        std::vector<edge_type> edges() const override
+        {
+            return std::vector<edge_type>(this->csr.edges, this->csr.edges + this->csr.edges_count);
+        }
+
+        std::vector<edge_type> adjacent_edges(const vertex_type & vertex) const override
+        {
+            std::vector<edge_type> result;
+
+            this->for_each_adjacent_edge(
+                    vertex, [&](const edge_type & edge) { result.push_back(edge); });
+            return result;
+        }
+
+        std::vector<vertex_type> neighbours(const vertex_type & vertex) const override
+        {
+            std::vector<vertex_type> result;
+
+            this->for_each_neighbour(
+                    vertex, [&](const vertex_type & neighbour) { result.push_back(neighbour); });
+            return result;
+        }
+
+        void for_each_neighbour(const vertex_type & vertex,
+                internal::function_ref<void(const vertex_type &)> function) const override
+        {
+            size_t vertex_index = this->index(vertex);
+
+            for(size_t i = this->csr.offsets[vertex_index]; i < this->csr.offsets[vertex_index + 1];
+                    ++i)
+                function(this->csr.vertices[this->csr.neighbour_indices[i]]);
+        }
+
+        bool any_neighbour(const vertex_type & vertex,
+                internal::function_ref<bool(const vertex_type &)> function) const override
+        {
+            size_t vertex_index = this->index(vertex);
+
+            for(size_t i = this->csr.offsets[vertex_index]; i < this->csr.offsets[vertex_index + 1];
+                    ++i)
+                if(function(this->csr.vertices[this->csr.neighbour_indices[i]]))
+                    return true;
+
+            return false;
+        }
+
+        void for_each_adjacent_edge(const vertex_type & vertex,
+                internal::function_ref<void(const edge_type &)> function) const override
+        {
+            size_t vertex_index = this->index(vertex);
+
+            for(size_t i = this->csr.offsets[vertex_index]; i < this->csr.offsets[vertex_index + 1];
+                    ++i)
+                function(this->csr.edges[this->csr.edge_indices[i]]);
+        }
+
+        void for_each_weighted_edge(const vertex_type & vertex,
+                internal::function_ref<void(const edge_type &, double)> function) const override
+        {
+            if(!this->weights_mapped())
+            {
+                graph<VertexId, VertexProperty, EdgeProperty>::for_each_weighted_edge(
+                        vertex, function);
+                return;
+            }
+
+            size_t vertex_index = this->index(vertex);
+
+            for(size_t i = this->csr.offsets[vertex_index]; i < this->csr.offsets[vertex_index + 1];
+                    ++i)
+            {
+                double weight = this->csr.weights[this->csr.edge_indices[i]];
+
+                if(std::isnan(weight))
+                    throw std::out_of_range("Property not found for edge");
+
+                function(this->csr.edges[this->csr.edge_indices[i]], weight);
+            }
+        }
+
+        void for_each_indexed_weighted_edge(size_t index,
+                internal::function_ref<void(size_t, const vertex_type &, double)> function)
+                const override
+        {
+            if constexpr(std::is_base_of_v<weighted, edge_property_type>)
+            {
+                for(size_t i = this->csr.offsets[index]; i < this->csr.offsets[index + 1]; ++i)
+                    function(this->csr.neighbour_indices[i],
+                            this->csr.vertices[this->csr.neighbour_indices[i]],
+                            this->edge_weight(this->csr.edge_indices[i]));
+            }
+            else
+                throw std::logic_error("Edge properties are not weighted");
+        }
+
+        size_t output_degree(const vertex_type & vertex) const override
+        {
+            size_t vertex_index = this->index(vertex);
+
+            return this->csr.offsets[vertex_index + 1] - this->csr.offsets[vertex_index];
+        }
+
+        /*!
+         * \brief Gets the index of given vertex in this graph.
+         * Vertices are indexed with consecutive numbers from zero in order of their identifiers.
+         * \param vertex the vertex from this graph
+         * \return the index of the vertex
+         * \throw std::invalid_argument if the vertex does not belong to this graph
+         */
+        size_t index(const vertex_type & vertex) const override;
+
+        bool is_indexed() const override
+        {
+            return true;
+        }
+
+        /*!
+         * \brief Gets the weight of given edge read from the file without creating its property.
+         * \param edge the edge from this graph
+         * \return the weight of the edge
+         * \throw std::out_of_range if the file has no weight for the edge
+         */
+        double weight(const edge_type & edge) const;
+
+    protected:
+        explicit mapped_graph(internal::mapped_csr<vertex_type, edge_type> csr)
+            : csr{std::move(csr)}, edge_properties_written{false}, graph_properties_{*this}
+        {
+        }
+
+        std::optional<size_t> find_edge(size_t source_index, size_t destination_index) const;
+        size_t edge_index(const edge_type & edge) const;
+
+        // Checks whether weights are read from the file, which holds them and is still up to date.
+        bool weights_mapped() const
+        {
+            return this->csr.weights != nullptr && !this->edge_properties_written;
+        }
+
+        // Gets the weight of the edge at given index from its property, or from the file if the
+        // edge has no property in memory.
+        double edge_weight(size_t edge_index) const
+        {
+            if(!this->weights_mapped() && !this->edge_properties.empty()
+                    && this->edge_properties[edge_index])
+                return this->edge_properties[edge_index]->weight();
+
+            if(this->csr.weights == nullptr || std::isnan(this->csr.weights[edge_index]))
+                throw std::out_of_range("Property not found for edge");
+
+            return this->csr.weights[edge_index];
+        }
+
+        internal::mapped_csr<vertex_type, edge_type> csr;
+
+    private:
+        using edge_properties_column = std::vector<std::optional<edge_property_type>>;
+
+        std::optional<edge_property_type> & edge_property(const edge_type & edge);
+        const std::optional<edge_property_type> & edge_property(const edge_type & edge) const;
+        std::shared_ptr<const edge_properties_column> file_edge_properties_column() const;
+
+        // properties live in memory and are created on first use
+        std::vector<std::optional<vertex_property_type>> vertex_properties;
+        std::vector<std::optional<edge_property_type>> edge_properties;
+        // properties created from weights in the file for readers, published once and never changed
+        mutable std::shared_ptr<const edge_properties_column> file_edge_properties;
+        // weights in the file are used directly until edge properties are accessed for writing
+        bool edge_properties_written;
+        graph_properties_impl graph_properties_;
+    };
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    const typename mapped_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type &
+            mapped_graph<VertexId, VertexProperty, EdgeProperty>::operator[](
+                    const vertex_id_type & vertex_id) const
+    {
+        const vertex_type * end = this->csr.vertices + this->csr.vertices_count;
+        const vertex_type * it = std::lower_bound(this->csr.vertices, end, vertex_type(vertex_id));
+
+        if(it != end && it->id() == vertex_id)
+            return *it;
+
+        throw std::out_of_range("Vertex not found");
+    }
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    const typename mapped_graph<VertexId, VertexProperty, EdgeProperty>::edge_type &
+            mapped_graph<VertexId, VertexProperty, EdgeProperty>::operator[](
+                    const std::pair<vertex_id_type, vertex_id_type> & vertex_ids) const
+    {
+        const vertex_type * end = this->csr.vertices + this->csr.vertices_count;
+        const vertex_type * source_it =
+                std::lower_bound(this->csr.vertices, end, vertex_type(vertex_ids.first));
+        const vertex_type * destination_it =
+                std::lower_bound(this->csr.vertices, end, vertex_type(vertex_ids.second));
+
+        if(source_it != end && source_it->id() == vertex_ids.first && destination_it != end
+                && destination_it->id() == vertex_ids.second)
+        {
+            std::optional<size_t> edge_index = this->find_edge(
+                    source_it - this->csr.vertices, destination_it - this->csr.vertices);
+
+            if(edge_index)
+                return this->csr.edges[*edge_index];
+        }
+
+        throw std::out_of_range("Edge not found");
+    }
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    size_t mapped_graph<VertexId, VertexProperty, EdgeProperty>::index(
+            const vertex_type & vertex) const
+    {
+        const vertex_type * end = this->csr.vertices + this->csr.vertices_count;
+        const vertex_type * it = std::lower_bound(this->csr.vertices, end, vertex);
+
+        if(it == end || *it != vertex)
+            throw std::invalid_argument("Vertex does not belong to the graph");
+
+        return it - this->csr.vertices;
+    }
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    double mapped_graph<VertexId, VertexProperty, EdgeProperty>::weight(
+            const edge_type & edge) const
+    {
+        size_t index = this->edge_index(edge);
+
+        if(this->csr.weights == nullptr || std::isnan(this->csr.weights[index]))
+            throw std::out_of_range("Weight not found for edge");
+
+        return this->csr.weights[index];
+    }
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    std::optional<size_t> mapped_graph<VertexId, VertexProperty, EdgeProperty>::find_edge(
+            size_t source_index, size_t destination_index) const
+    {
+        const size_t * begin = this->csr.neighbour_indices + this->csr.offsets[source_index];
+        const size_t * end = this->csr.neighbour_indices + this->csr.offsets[source_index + 1];
+        const size_t * it = std::lower_bound(begin, end, destination_index);
+
+        if(it == end || *it != destination_index)
+            return std::nullopt;
+
+        return std::make_optional(this->csr.edge_indices[it - this->csr.neighbour_indices]);
+    }
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    size_t mapped_graph<VertexId, VertexProperty, EdgeProperty>::edge_index(
+            const edge_type & edge) const
+    {
+        const vertex_type * end = this->csr.vertices + this->csr.vertices_count;
+        const vertex_type * source_it = std::lower_bound(this->csr.vertices, end, edge.source());
+        const vertex_type * destination_it =
+                std::lower_bound(this->csr.vertices, end, edge.destination());
+
+        if(source_it != end && *source_it == edge.source() && destination_it != end
+                && *destination_it == edge.destination())
+        {
+            std::optional<size_t> edge_index = this->find_edge(
+                    source_it - this->csr.vertices, destination_it - this->csr.vertices);
+
+            if(edge_index && this->csr.edges[*edge_index] == edge)
+                return *edge_index;
+        }
+
+        throw std::invalid_argument("Edge does not belong to the graph");
+    }
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    std::optional<typename mapped_graph<VertexId, VertexProperty, EdgeProperty>::
+                    edge_property_type> &
+            mapped_graph<VertexId, VertexProperty, EdgeProperty>::edge_property(
+                    const edge_type & edge)
+    {
+        size_t index = this->edge_index(edge);
+
+        if(this->edge_properties.empty())
+            this->edge_properties.resize(this->csr.edges_count);
+
+        std::optional<edge_property_type> & property = this->edge_properties[index];
+
+        // properties of weighted edges are created from weights in the file
+        if constexpr(std::is_constructible_v<edge_property_type, double>)
+            if(!property && this->csr.weights != nullptr && !std::isnan(this->csr.weights[index]))
+                property.emplace(this->csr.weights[index]);
+
+        return property;
+    }
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    const std::optional<typename mapped_graph<VertexId, VertexProperty, EdgeProperty>::
+                    edge_property_type> &
+            mapped_graph<VertexId, VertexProperty, EdgeProperty>::edge_property(
+                    const edge_type & edge) const
+    {
+        static const std::optional<edge_property_type> no_property;
+
+        size_t index = this->edge_index(edge);
+
+        if(!this->edge_properties.empty() && this->edge_properties[index])
+            return this->edge_properties[index];
+
+        if(this->csr.weights == nullptr || std::isnan(this->csr.weights[index]))
+            return no_property;
+
+        return (*this->file_edge_properties_column())[index];
+    }
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    std::shared_ptr<const typename mapped_graph<VertexId, VertexProperty, EdgeProperty>::
+                    edge_properties_column>
+            mapped_graph<VertexId, VertexProperty, EdgeProperty>::file_edge_properties_column()
+                    const
+    {
+        std::shared_ptr<const edge_properties_column> column =
+                std::atomic_load(&this->file_edge_properties);
+
+        if(column)
+            return column;
+
+        auto new_column = std::make_shared<edge_properties_column>(this->csr.edges_count);
+
+        if constexpr(std::is_constructible_v<edge_property_type, double>)
+            for(size_t i = 0; i < this->csr.edges_count; ++i)
+                if(!std::isnan(this->csr.weights[i]))
+                    (*new_column)[i].emplace(this->csr.weights[i]);
+
+        // only the first column is published, so references given to readers stay valid
+        std::shared_ptr<const edge_properties_column> published = new_column;
+
+        std::atomic_compare_exchange_strong(&this->file_edge_properties, &column, published);
+        return column ? column : published;
+    }
+
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    class mapped_graph<VertexId, VertexProperty, EdgeProperty>::graph_properties_impl
+        : public virtual graph<VertexId, VertexProperty, EdgeProperty>::graph_properties
+    {
+    public:
+        explicit graph_properties_impl(mapped_graph<VertexId, VertexProperty, EdgeProperty> & graph)
+            : graph{graph}
+        {
+        }
+
+        vertex_property_type & operator[](const vertex_type & vertex) override
+        {
+            std::optional<vertex_property_type> & property = this->vertex_property(vertex);
+
+            if(!property)
+                property.emplace();
+
+            return *property;
+        }
+
+        vertex_property_type & at(const vertex_type & vertex) override
+        {
+            std::optional<vertex_property_type> & property = this->vertex_property(vertex);
+
+            if(!property)
+                throw std::out_of_range("Property not found for vertex");
+
+            return *property;
+        }
+
+        const vertex_property_type & at(const vertex_type & vertex) const override
+        {
+            size_t index = graph.index(vertex);
+
+            if(graph.vertex_properties.empty() || !graph.vertex_properties[index])
+                throw std::out_of_range("Property not found for vertex");
+
+            return *graph.vertex_properties[index];
+        }
+
+        edge_property_type & operator[](const edge_type & edge) override
+        {
+            std::optional<edge_property_type> & property = graph.edge_property(edge);
+
+            graph.edge_properties_written = true;
+
+            if(!property)
+                property.emplace();
+
+            return *property;
+        }
+
+        edge_property_type & at(const edge_type & edge) override
+        {
+            std::optional<edge_property_type> & property = graph.edge_property(edge);
+
+            if(!property)
+                throw std::out_of_range("Property not found for edge");
+
+            graph.edge_properties_written = true;
+            return *property;
+        }
+
+        const edge_property_type & at(const edge_type & edge) const override
+        {
+            const std::optional<edge_property_type> & property =
+                    std::as_const(graph).edge_property(edge);
+
+            if(!property)
+                throw std::out_of_range("Property not found for edge");
+
+            return *property;
+        }
+
+    private:
+        std::optional<vertex_property_type> & vertex_property(const vertex_type & vertex)
+        {
+            size_t index = graph.index(vertex);
+
+            if(graph.vertex_properties.empty())
+                graph.vertex_properties.resize(graph.csr.vertices_count);
+
+            return graph.vertex_properties[index];
+        }
+
+        mapped_graph<VertexId, VertexProperty, EdgeProperty> & graph;
+    };
+
+    template <typename VertexId = size_t,
+            typename VertexProperty = std::nullptr_t,
+            typename EdgeProperty = std::nullptr_t>
+    class directed_mapped_graph
+        : public mapped_graph<VertexId, VertexProperty, EdgeProperty>,
+          public virtual directed_graph<VertexId, VertexProperty, EdgeProperty>
+    {
+    public:
+        using vertex_id_type =
+                typename mapped_graph<VertexId, VertexProperty, EdgeProperty>::vertex_id_type;
+        using vertex_type =
+                typename mapped_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type;
+        using edge_type = typename mapped_graph<VertexId, VertexProperty, EdgeProperty>::edge_type;
+        using vertex_property_type =
+                typename mapped_graph<VertexId, VertexProperty, EdgeProperty>::vertex_property_type;
+        using edge_property_type =
+                typename mapped_graph<VertexId, VertexProperty, EdgeProperty>::edge_property_type;
+
+        /*!
+         * \brief Maps the directed graph from given binary graph file.
+         * \param path the path of the file written with write_graph
+         * \throw std::system_error if the file cannot be mapped
+         * \throw std::runtime_error if the file does not contain such directed graph
+         */
+        explicit directed_mapped_graph(const std::string & path)
+            : mapped_graph<VertexId, VertexProperty, EdgeProperty>(
+                    internal::map_graph_file<vertex_type, edge_type>(path, true))
+        {
+        }
+
+        ~directed_mapped_graph() override = default;
+        directed_mapped_graph(const directed_mapped_graph &) = default;
+        directed_mapped_graph(directed_mapped_graph &&) = default;
+        directed_mapped_graph & operator=(const directed_mapped_graph &) = default;
+        directed_mapped_graph & operator=(directed_mapped_graph &&) = default;
+
+        size_t input_degree(const vertex_type & vertex) const override
+        {
+            size_t vertex_index = this->index(vertex);
+
+            return this->csr.input_offsets[vertex_index + 1]
+                   - this->csr.input_offsets[vertex_index];
+        }
+
+        bool indexes_incoming() const override
+        {
+            return true;
+        }
+
+        std::vector<vertex_type> predecessors(const vertex_type & vertex) const override
+        {
+            size_t vertex_index = this->index(vertex);
+            std::vector<vertex_type> result;
+
+            for(size_t i = this->csr.input_offsets[vertex_index];
+                    i < this->csr.input_offsets[vertex_index + 1]; ++i)
+                result.push_back(this->csr.vertices[this->csr.input_neighbour_indices[i]]);
+
+            return result;
+        }
+
+        std::vector<edge_type> incoming_edges(const vertex_type & vertex) const override
+        {
+            size_t vertex_index = this->index(vertex);
+            std::vector<edge_type> result;
+
+            for(size_t i = this->csr.input_offsets[vertex_index];
+                    i < this->csr.input_offsets[vertex_index + 1]; ++i)
+                result.push_back(this->csr.edges[this->csr.input_edge_indices[i]]);
+
+            return result;
+        }
+
+        void for_each_incoming_edge(const vertex_type & vertex,
+                internal::function_ref<void(const edge_type &)> function) const override
+        {
+            size_t vertex_index = this->index(vertex);
+
+            for(size_t i = this->csr.input_offsets[vertex_index];
+                    i < this->csr.input_offsets[vertex_index + 1]; ++i)
+                function(this->csr.edges[this->csr.input_edge_indices[i]]);
+        }
+
+        void for_each_incoming_weighted_edge(const vertex_type & vertex,
+                internal::function_ref<void(const edge_type &, double)> function) const override
+        {
+            if(!this->weights_mapped())
+            {
+                directed_graph<VertexId, VertexProperty, EdgeProperty>::
+                        for_each_incoming_weighted_edge(vertex, function);
+                return;
+            }
+
+            size_t vertex_index = this->index(vertex);
+
+            for(size_t i = this->csr.input_offsets[vertex_index];
+                    i < this->csr.input_offsets[vertex_index + 1]; ++i)
+            {
+                double weight = this->csr.weights[this->csr.input_edge_indices[i]];
+
+                if(std::isnan(weight))
+                    throw std::out_of_range("Property not found for edge");
+
+                function(this->csr.edges[this->csr.input_edge_indices[i]], weight);
+            }
+        }
+
+        void for_each_incoming_indexed_weighted_edge(size_t index,
+                internal::function_ref<void(size_t, const vertex_type &, double)> function)
+                const override
+        {
+            if constexpr(std::is_base_of_v<weighted, edge_property_type>)
+            {
+                for(size_t i = this->csr.input_offsets[index];
+                        i < this->csr.input_offsets[index + 1]; ++i)
+                    function(this->csr.input_neighbour_indices[i],
+                            this->csr.vertices[this->csr.input_neighbour_indices[i]],
+                            this->edge_weight(this->csr.input_edge_indices[i]));
+            }
+            else
+                throw std::logic_error("Edge properties are not weighted");
+        }
+
+        //! \throw std::logic_error always, as mapped graphs are read-only
+        void reverse() override
+        {
+            throw std::logic_error("Mapped graph cannot be modified");
+        }
+    };
+
+    template <typename VertexId = size_t,
+            typename VertexProperty = std::nullptr_t,
+            typename EdgeProperty = std::nullptr_t>
+    class undirected_mapped_graph
+        : public mapped_graph<VertexId, VertexProperty, EdgeProperty>,
+          public virtual undirected_graph<VertexId, VertexProperty, EdgeProperty>
+    {
+    public:
+        using vertex_id_type =
+                typename mapped_graph<VertexId, VertexProperty, EdgeProperty>::vertex_id_type;
+        using vertex_type =
+                typename mapped_graph<VertexId, VertexProperty, EdgeProperty>::vertex_type;
+        using edge_type = typename mapped_graph<VertexId, VertexProperty, EdgeProperty>::edge_type;
+        using vertex_property_type =
+                typename mapped_graph<VertexId, VertexProperty, EdgeProperty>::vertex_property_type;
+        using edge_property_type =
+                typename mapped_graph<VertexId, VertexProperty, EdgeProperty>::edge_property_type;
+
+        /*!
+         * \brief Maps the undirected graph from given binary graph file.
+         * \param path the path of the file written with write_graph
+         * \throw std::system_error if the file cannot be mapped
+         * \throw std::runtime_error if the file does not contain such undirected graph
+         */
+        explicit undirected_mapped_graph(const std::string & path)
+            : mapped_graph<VertexId, VertexProperty, EdgeProperty>(
+                    internal::map_graph_file<vertex_type, edge_type>(path, false))
+        {
+        }
+
+        ~undirected_mapped_graph() override = default;
+        undirected_mapped_graph(const undirected_mapped_graph &) = default;
+        undirected_mapped_graph(undirected_mapped_graph &&) = default;
+        undirected_mapped_graph & operator=(const undirected_mapped_graph &) = default;
+        undirected_mapped_graph & operator=(undirected_mapped_graph &&) = default;
+
+        size_t input_degree(const vertex_type & vertex) const override
+        {
+            return this->output_degree(vertex);
+        }
+    };
+}
+
+#endif
@@ -6,10 +6,14 @@
 #define MULTIPARTITE_GRAPH_HPP_
 
 #include <algorithm>
+#include <array>
 #include <exception>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
+#include "algolib/graphs/flat_hash.hpp"
 #include "algolib/graphs/undirected_graph.hpp"
 
 using namespace std::string_literals;
@@ -50,7 +54,15 @@ namespace algolib::graphs
                 undirected_simple_graph<vertex_id_type, vertex_property_type, edge_property_type>;
 
     public:
-        explicit multipartite_graph(std::array<std::vector<vertex_id_type>, N> vertex_ids)
+        /*!
+         * \param vertex_ids the identifiers of initial vertices in each group
+         * \param resource the memory resource to allocate all structures of this graph from
+         */
+        explicit multipartite_graph(std::array<std::vector<vertex_id_type>, N> vertex_ids,
+                std::pmr::memory_resource * resource = std::pmr::get_default_resource())
+            : graph{graph_t({}, resource)},
+              groups{new_groups(resource, std::make_index_sequence<N>())},
+              vertex_group_map{resource}
         {
             int i = 0;
 
@@ -64,7 +76,17 @@ namespace algolib::graphs
         }
 
         ~multipartite_graph() override = default;
-        multipartite_graph(const multipartite_graph &) = default;
+
+        // copies of groups are allocated from the same memory resource, as the graph is
+        multipartite_graph(const multipartite_graph & multipartite)
+            : graph{multipartite.graph},
+              groups{new_groups(multipartite.graph.resource(), std::make_index_sequence<N>())},
+              vertex_group_map{multipartite.vertex_group_map}
+        {
+            for(size_t i = 0; i < N; ++i)
+                this->groups[i] = multipartite.groups[i];
+        }
+
         multipartite_graph(multipartite_graph &&) = default;
         multipartite_graph & operator=(const multipartite_graph &) = default;
         multipartite_graph & operator=(multipartite_graph &&) = default;
@@ -128,6 +150,24 @@ namespace algolib::graphs
             return this->graph.neighbours(vertex);
         }
 
+        void for_each_neighbour(const vertex_type & vertex,
+                internal::function_ref<void(const vertex_type &)> function) const override
+        {
+            this->graph.for_each_neighbour(vertex, function);
+        }
+
+        bool any_neighbour(const vertex_type & vertex,
+                internal::function_ref<bool(const vertex_type &)> function) const override
+        {
+            return this->graph.any_neighbour(vertex, function);
+        }
+
+        void for_each_adjacent_edge(const vertex_type & vertex,
+                internal::function_ref<void(const edge_type &)> function) const override
+        {
+            this->graph.for_each_adjacent_edge(vertex, function);
+        }
+
         size_t output_degree(const vertex_type & vertex) const override
         {
             return this->graph.output_degree(vertex);
@@ -139,11 +179,26 @@ namespace algolib::graphs
         }
 
         /*!
-         * \brief Gets the vertices of given group.
+         * \brief Gets the vertices of given group in order of their addition.
          * \param group_number the group number
-         * \return the vertices that belong to the group
+         * \return the vertices that belong to the group, valid until next vertex is added
+         */
+        const std::pmr::vector<vertex_type> & vertices_from_group(size_t group_number) const
+        {
+            this->validate_group(group_number);
+            return this->groups[group_number];
+        }
+
+        /*!
+         * \brief Gets the group of given vertex.
+         * \param vertex the vertex
+         * \return the number of group the vertex belongs to
+         * \throw std::out_of_range if the vertex does not belong to this graph
          */
-        std::vector<vertex_type> vertices_from_group(size_t group_number) const;
+        size_t group_of(const vertex_type & vertex) const
+        {
+            return this->vertex_group_map.at(vertex);
+        }
 
         /*!
          * \brief Adds new vertex to given group in this graph.
@@ -226,7 +281,7 @@ namespace algolib::graphs
     private:
         bool are_in_same_group(const vertex_type & vertex1, const vertex_type & vertex2) const
         {
-            return this->vertex_group_map.at(vertex1) == this->vertex_group_map.at(vertex2);
+            return this->group_of(vertex1) == this->group_of(vertex2);
         }
 
         void validate_group(size_t group_number) const
@@ -237,30 +292,19 @@ namespace algolib::graphs
                                         + " groups"s);
         }
 
+        template <size_t... Indices>
+        static std::array<std::pmr::vector<vertex_type>, N> new_groups(
+                std::pmr::memory_resource * resource, std::index_sequence<Indices...>)
+        {
+            return {{((void)Indices, std::pmr::vector<vertex_type>(resource))...}};
+        }
+
         graph_t graph;
-        std::unordered_map<vertex_type, size_t> vertex_group_map;
+        // vertices of each group in order of addition
+        std::array<std::pmr::vector<vertex_type>, N> groups;
+        internal::pmr::flat_hash_map<vertex_type, size_t> vertex_group_map;
     };
 
-    template <size_t N, typename VertexId, typename VertexProperty, typename EdgeProperty>
-    std::vector<typename multipartite_graph<N, VertexId, VertexProperty, EdgeProperty>::vertex_type>
-            multipartite_graph<N, VertexId, VertexProperty, EdgeProperty>::vertices_from_group(
-                    size_t group_number) const
-    {
-        std::vector<vertex_type> result;
-        std::vector<std::pair<vertex_type, size_t>> group_vertices;
-
-        this->validate_group(group_number);
-
-        std::copy(this->vertex_group_map.begin(), this->vertex_group_map.end(),
-                std::back_inserter(group_vertices));
-        group_vertices.erase(std::remove_if(group_vertices.begin(), group_vertices.end(),
-                                     [&](auto && p) { return p.second != group_number; }),
-                group_vertices.end());
-        std::transform(group_vertices.begin(), group_vertices.end(), std::back_inserter(result),
-                [](auto && p) { return p.first; });
-        return result;
-    }
-
     template <size_t N, typename VertexId, typename VertexProperty, typename EdgeProperty>
     typename multipartite_graph<N, VertexId, VertexProperty, EdgeProperty>::vertex_type
             multipartite_graph<N, VertexId, VertexProperty, EdgeProperty>::add_vertex(
@@ -291,6 +335,7 @@ namespace algolib::graphs
         vertex_type new_vertex = this->graph.add_vertex(vertex);
 
         this->vertex_group_map.emplace(new_vertex, group_number);
+        this->groups[group_number].push_back(new_vertex);
         return new_vertex;
     }
 
@@ -306,6 +351,7 @@ namespace algolib::graphs
         vertex_type new_vertex = this->graph.add_vertex(vertex, property);
 
         this->vertex_group_map.emplace(new_vertex, group_number);
+        this->groups[group_number].push_back(new_vertex);
         return new_vertex;
     }
 
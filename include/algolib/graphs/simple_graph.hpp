@@ -6,16 +6,35 @@
 #define SIMPLE_GRAPH_HPP_
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <optional>
 #include <stdexcept>
 #include <unordered_map>
-#include <unordered_set>
+#include <utility>
 #include <vector>
+#include "algolib/graphs/flat_hash.hpp"
 #include "algolib/graphs/graph.hpp"
 
 namespace internal
 {
     namespace algr = algolib::graphs;
 
+    /*
+     * Adjacency of graph with copy-on-write structural sharing. Copies share the map of vertices
+     * and all vertex entries; a modification copies the map and the entries it touches only if
+     * they are still shared with another copy. Containers created with polymorphic allocators
+     * receive the memory resource through uses-allocator construction. Adjacency is kept in flat
+     * hash tables, so references to edges are valid only until the next modification of the graph,
+     * and so are constant references to properties. Vertices are allocated once and shared by all
+     * copies of their entry, so references to them stay valid while the vertex is in the graph.
+     * Properties are kept apart from adjacency in their own copy-on-write map of per-vertex
+     * entries. Property entries handed out for writing are exposed, since the references may be
+     * written at any time; they are never shared, so copying a graph copies them at once, but
+     * neither the adjacency nor the map of vertices.
+     */
     template <typename VertexId,
             typename Vertex,
             typename Edge,
@@ -30,48 +49,257 @@ namespace internal
         using vertex_property_type = VertexProperty;
         using edge_property_type = EdgeProperty;
 
-        explicit graph_representation(const std::vector<vertex_id_type> & vertex_ids = {})
+        explicit graph_representation(const std::vector<vertex_id_type> & vertex_ids = {},
+                std::pmr::memory_resource * resource = std::pmr::get_default_resource())
+            : resource_{resource},
+              graph_map{this->new_map()},
+              property_map{this->new_property_map()}
         {
+            this->graph_map->reserve(vertex_ids.size());
+
             for(const vertex_id_type & vertex_id : vertex_ids)
-                this->graph_map.emplace(vertex_type(vertex_id), std::unordered_set<Edge>());
+            {
+                vertex_type vertex(vertex_id);
+
+                this->graph_map->emplace(vertex, this->new_entry(vertex));
+            }
         }
 
         ~graph_representation() = default;
-        graph_representation(const graph_representation &) = default;
-        graph_representation(graph_representation &&) = default;
-        graph_representation & operator=(const graph_representation &) = default;
-        graph_representation & operator=(graph_representation &&) = default;
+
+        graph_representation(const graph_representation & representation)
+            : resource_{representation.resource_},
+              graph_map{representation.graph_map},
+              property_map{representation.property_map}
+        {
+            if(representation.exposed_count > 0)
+                this->copy_exposed();
+        }
+
+        // moved-from representation is left empty, but still usable
+        graph_representation(graph_representation && representation)
+            : resource_{representation.resource_},
+              graph_map{std::exchange(representation.graph_map, representation.new_map())},
+              property_map{std::exchange(
+                      representation.property_map, representation.new_property_map())},
+              exposed_count{std::exchange(representation.exposed_count, 0)}
+        {
+        }
+
+        graph_representation & operator=(const graph_representation & representation)
+        {
+            if(this != &representation)
+                *this = graph_representation(representation);
+
+            return *this;
+        }
+
+        graph_representation & operator=(graph_representation && representation)
+        {
+            if(this != &representation)
+            {
+                this->resource_ = representation.resource_;
+                this->graph_map =
+                        std::exchange(representation.graph_map, representation.new_map());
+                this->property_map = std::exchange(
+                        representation.property_map, representation.new_property_map());
+                this->exposed_count = std::exchange(representation.exposed_count, 0);
+            }
+
+            return *this;
+        }
 
         size_t size() const
         {
-            return this->graph_map.size();
+            return this->graph_map->size();
+        }
+
+        std::pmr::memory_resource * resource() const
+        {
+            return this->resource_;
         }
 
         const vertex_type & operator[](const vertex_id_type & vertex_id) const;
         const edge_type & operator[](
                 const std::pair<vertex_id_type, vertex_id_type> & vertex_ids) const;
 
+        const edge_type * find_edge(const vertex_id_type & source_id,
+                const vertex_id_type & destination_id) const;
         std::vector<vertex_type> vertices() const;
         std::vector<edge_type> edges() const;
-        std::vector<std::unordered_set<edge_type>> edges_set() const;
+        size_t adjacent_edges_total() const;
         std::vector<edge_type> adjacent_edges(const vertex_type & vertex) const;
+
+        template <typename Function>
+        void for_each_adjacent_edge(const vertex_type & vertex, Function && function) const
+        {
+            for(auto && edge : this->entry(vertex).edges)
+                function(edge);
+        }
+
+        template <typename Function>
+        bool any_adjacent_edge(const vertex_type & vertex, Function && function) const
+        {
+            for(auto && edge : this->entry(vertex).edges)
+                if(function(edge))
+                    return true;
+
+            return false;
+        }
+
+        size_t adjacent_edges_count(const vertex_type & vertex) const
+        {
+            return this->entry(vertex).edges.size();
+        }
+
+        template <typename Function>
+        void for_each_edge(Function && function) const
+        {
+            for(auto && entry : *this->graph_map)
+                for(auto && edge : entry.second->edges)
+                    function(edge);
+        }
+
+        template <typename Function>
+        void for_each_incoming_edge(const vertex_type & vertex, Function && function) const
+        {
+            for(auto && edge : this->entry(vertex).incoming_edges)
+                function(edge);
+        }
+
+        size_t incoming_edges_count(const vertex_type & vertex) const
+        {
+            return this->entry(vertex).incoming_edges.size();
+        }
+
         vertex_property_type & property(const vertex_type & vertex);
         vertex_property_type & property_at(const vertex_type & vertex);
         const vertex_property_type & property_at(const vertex_type & vertex) const;
         edge_property_type & property(const edge_type & edge);
         edge_property_type & property_at(const edge_type & edge);
         const edge_property_type & property_at(const edge_type & edge) const;
+        const vertex_property_type * find_property(const vertex_type & vertex) const;
+        const edge_property_type * find_property(const edge_type & edge) const;
+        void set_property(const vertex_type & vertex, const vertex_property_type & property);
+        void set_property(const edge_type & edge, const edge_property_type & property);
         bool add_vertex(const vertex_type & vertex);
         void add_edge_to_source(const edge_type & edge);
         void add_edge_to_destination(const edge_type & edge);
+        void add_incoming_edge(const edge_type & edge);
+
+        // Reserves the edge set of the vertex for given number of adjacent edges.
+        void reserve_edges(const vertex_type & vertex, size_t edges_count);
+
+        /*
+         * Adds the edge to its source, and also to its destination if to_destination. The edge
+         * must be absent from this representation and its vertices must be present, as these are
+         * not checked.
+         */
+        void add_edge_unchecked(const edge_type & edge, bool to_destination);
+
+        // Sets the property of the edge, which must be present, as this is not checked.
+        void set_property_unchecked(const edge_type & edge, const edge_property_type & property);
 
     private:
-        void validate(const vertex_type & vertex) const;
+        using edge_set = pmr::flat_hash_set<edge_type>;
+
+        struct vertex_entry
+        {
+            vertex_entry(std::shared_ptr<const vertex_type> vertex,
+                    std::pmr::memory_resource * resource)
+                : vertex{std::move(vertex)}, edges{resource}, incoming_edges{resource}
+            {
+            }
+
+            vertex_entry(const vertex_entry & entry, std::pmr::memory_resource * resource)
+                : vertex{entry.vertex},
+                  edges{entry.edges, resource},
+                  incoming_edges{entry.incoming_edges, resource}
+            {
+            }
+
+            std::shared_ptr<const vertex_type> vertex;
+            edge_set edges;
+            // filled only for directed graphs with index of incoming edges, otherwise empty and
+            // unallocated
+            edge_set incoming_edges;
+        };
+
+        struct property_entry
+        {
+            explicit property_entry(std::pmr::memory_resource * resource)
+                : edge_properties{resource}
+            {
+            }
+
+            property_entry(const property_entry & entry, std::pmr::memory_resource * resource)
+                : property{entry.property}, edge_properties{entry.edge_properties, resource}
+            {
+            }
+
+            std::optional<vertex_property_type> property;
+            // properties of edges with this vertex as their source; node-based, so references to
+            // properties stay valid when other properties are added
+            std::pmr::unordered_map<edge_type, edge_property_type> edge_properties;
+            // whether references to properties were handed out for writing; never copied
+            bool exposed = false;
+        };
+
+        using entry_map = pmr::flat_hash_map<vertex_type, std::shared_ptr<vertex_entry>>;
+        // entries only for vertices with any properties set
+        using properties_map = pmr::flat_hash_map<vertex_type, std::shared_ptr<property_entry>>;
+
+        std::shared_ptr<entry_map> new_map() const
+        {
+            return std::allocate_shared<entry_map>(
+                    std::pmr::polymorphic_allocator<entry_map>(this->resource_));
+        }
+
+        std::shared_ptr<properties_map> new_property_map() const
+        {
+            return std::allocate_shared<properties_map>(
+                    std::pmr::polymorphic_allocator<properties_map>(this->resource_));
+        }
+
+        std::shared_ptr<vertex_entry> new_entry(const vertex_type & vertex) const
+        {
+            return std::allocate_shared<vertex_entry>(
+                    std::pmr::polymorphic_allocator<vertex_entry>(this->resource_),
+                    std::allocate_shared<vertex_type>(
+                            std::pmr::polymorphic_allocator<vertex_type>(this->resource_),
+                            vertex),
+                    this->resource_);
+        }
+
+        std::shared_ptr<vertex_entry> copy_entry(const vertex_entry & entry) const
+        {
+            return std::allocate_shared<vertex_entry>(
+                    std::pmr::polymorphic_allocator<vertex_entry>(this->resource_), entry,
+                    this->resource_);
+        }
+
+        std::shared_ptr<property_entry> copy_properties(const property_entry & entry) const
+        {
+            return std::allocate_shared<property_entry>(
+                    std::pmr::polymorphic_allocator<property_entry>(this->resource_), entry,
+                    this->resource_);
+        }
+
+        const vertex_entry & entry(const vertex_type & vertex) const;
+        const property_entry * find_properties(const vertex_type & vertex) const;
+        vertex_entry & mutable_entry(const vertex_type & vertex);
+        vertex_entry & unshared_entry(const vertex_type & vertex);
+        property_entry & mutable_properties(const vertex_type & vertex);
+        property_entry & exposed_properties(const vertex_type & vertex);
+        entry_map & mutable_map();
+        properties_map & mutable_property_map();
+        void copy_exposed();
         void validate(const edge_type & edge, bool existing) const;
 
-        std::unordered_map<vertex_type, std::unordered_set<edge_type>> graph_map;
-        std::unordered_map<vertex_type, vertex_property_type> vertex_properties;
-        std::unordered_map<edge_type, edge_property_type> edge_properties;
+        std::pmr::memory_resource * resource_;
+        std::shared_ptr<entry_map> graph_map;
+        std::shared_ptr<properties_map> property_map;
+        size_t exposed_count = 0;
     };
 
     template <typename VertexId,
@@ -84,11 +312,10 @@ namespace internal
             graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::operator[](
                     const vertex_id_type & vertex_id) const
     {
-        auto && it = std::find_if(this->graph_map.begin(), this->graph_map.end(),
-                [&](auto && entry) { return entry.first.id() == vertex_id; });
+        auto it = this->graph_map->find(vertex_type(vertex_id));
 
-        if(it != this->graph_map.end())
-            return it->first;
+        if(it != this->graph_map->end())
+            return *it->second->vertex;
 
         throw std::out_of_range("Vertex not found");
     }
@@ -103,22 +330,39 @@ namespace internal
             graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::operator[](
                     const std::pair<vertex_id_type, vertex_id_type> & vertex_ids) const
     {
-        vertex_id_type source_id = vertex_ids.first, destination_id = vertex_ids.second;
+        const edge_type * edge = this->find_edge(vertex_ids.first, vertex_ids.second);
 
-        auto && entry_it = std::find_if(this->graph_map.begin(), this->graph_map.end(),
-                [&](auto && entry) { return entry.first.id() == source_id; });
+        if(edge != nullptr)
+            return *edge;
 
-        if(entry_it != this->graph_map.end())
-        {
-            auto && edge_it = std::find_if(std::begin(entry_it->second), std::end(entry_it->second),
-                    [&](auto && edge)
-                    { return edge.get_neighbour(entry_it->first).id() == destination_id; });
+        throw std::out_of_range("Edge not found");
+    }
 
-            if(edge_it != std::end(entry_it->second))
-                return *edge_it;
-        }
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    const typename graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            edge_type *
+            graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::find_edge(
+                    const vertex_id_type & source_id,
+                    const vertex_id_type & destination_id) const
+    {
+        auto entry_it = this->graph_map->find(vertex_type(source_id));
 
-        throw std::out_of_range("Edge not found");
+        if(entry_it == this->graph_map->end())
+            return nullptr;
+
+        const edge_set & edges = entry_it->second->edges;
+        vertex_type source = entry_it->first, destination(destination_id);
+        // edges of undirected graphs are stored in both vertices in their original direction
+        auto edge_it = edges.find(edge_type(source, destination));
+
+        if(edge_it == edges.end())
+            edge_it = edges.find(edge_type(destination, source));
+
+        return edge_it == edges.end() ? nullptr : &*edge_it;
     }
 
     template <typename VertexId,
@@ -133,8 +377,9 @@ namespace internal
     {
         std::vector<vertex_type> result;
 
-        std::transform(this->graph_map.begin(), this->graph_map.end(), std::back_inserter(result),
-                [](auto && entry) { return entry.first; });
+        result.reserve(this->graph_map->size());
+        std::transform(this->graph_map->begin(), this->graph_map->end(),
+                std::back_inserter(result), [](auto && entry) { return entry.first; });
         return result;
     }
 
@@ -150,10 +395,11 @@ namespace internal
     {
         std::vector<edge_type> result;
 
-        std::for_each(this->graph_map.begin(), this->graph_map.end(),
+        std::for_each(this->graph_map->begin(), this->graph_map->end(),
                 [&](auto && entry)
                 {
-                    std::copy(entry.second.begin(), entry.second.end(), std::back_inserter(result));
+                    std::copy(entry.second->edges.begin(), entry.second->edges.end(),
+                            std::back_inserter(result));
                 });
         return result;
     }
@@ -163,17 +409,11 @@ namespace internal
             typename Edge,
             typename VertexProperty,
             typename EdgeProperty>
-    std::vector<std::unordered_set<
-            typename graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
-                    edge_type
-    >> graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::edges_set() const
+    size_t graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            adjacent_edges_total() const
     {
-        std::vector<std::unordered_set<edge_type>>
-                result;
-
-        std::transform(this->graph_map.begin(), this->graph_map.end(), std::back_inserter(result),
-                [](auto && entry) { return entry.second; });
-        return result;
+        return std::accumulate(this->graph_map->begin(), this->graph_map->end(), size_t(0),
+                [](size_t acc, auto && entry) { return acc + entry.second->edges.size(); });
     }
 
     template <typename VertexId,
@@ -187,9 +427,9 @@ namespace internal
     > graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
             adjacent_edges(const vertex_type & vertex) const
     {
-        this->validate(vertex);
-        return std::vector<edge_type>(this->graph_map.at(vertex).begin(),
-                this->graph_map.at(vertex).end());
+        const vertex_entry & entry = this->entry(vertex);
+
+        return std::vector<edge_type>(entry.edges.begin(), entry.edges.end());
     }
 
     template <typename VertexId,
@@ -202,8 +442,13 @@ namespace internal
             graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::property(
                     const vertex_type & vertex)
     {
-        this->validate(vertex);
-        return this->vertex_properties[vertex];
+        std::optional<vertex_property_type> & property =
+                this->exposed_properties(vertex).property;
+
+        if(!property)
+            property.emplace();
+
+        return *property;
     }
 
     template <typename VertexId,
@@ -216,16 +461,12 @@ namespace internal
             graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::property_at(
                     const vertex_type & vertex)
     {
-        this->validate(vertex);
+        this->entry(vertex);
 
-        try
-        {
-            return this->vertex_properties.at(vertex);
-        }
-        catch(const std::out_of_range &)
-        {
+        if(this->find_property(vertex) == nullptr)
             throw std::out_of_range("Property not found for vertex");
-        }
+
+        return *this->exposed_properties(vertex).property;
     }
 
     template <typename VertexId,
@@ -238,16 +479,14 @@ namespace internal
             graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::property_at(
                     const vertex_type & vertex) const
     {
-        this->validate(vertex);
+        this->entry(vertex);
 
-        try
-        {
-            return this->vertex_properties.at(vertex);
-        }
-        catch(const std::out_of_range &)
-        {
+        const vertex_property_type * property = this->find_property(vertex);
+
+        if(property == nullptr)
             throw std::out_of_range("Property not found for vertex");
-        }
+
+        return *property;
     }
 
     template <typename VertexId,
@@ -261,7 +500,7 @@ namespace internal
                     const edge_type & edge)
     {
         this->validate(edge, true);
-        return this->edge_properties[edge];
+        return this->exposed_properties(edge.source()).edge_properties[edge];
     }
 
     template <typename VertexId,
@@ -276,14 +515,10 @@ namespace internal
     {
         this->validate(edge, true);
 
-        try
-        {
-            return this->edge_properties.at(edge);
-        }
-        catch(const std::out_of_range &)
-        {
+        if(this->find_property(edge) == nullptr)
             throw std::out_of_range("Property not found for edge");
-        }
+
+        return this->exposed_properties(edge.source()).edge_properties.at(edge);
     }
 
     template <typename VertexId,
@@ -298,14 +533,72 @@ namespace internal
     {
         this->validate(edge, true);
 
-        try
-        {
-            return this->edge_properties.at(edge);
-        }
-        catch(const std::out_of_range &)
-        {
+        const edge_property_type * property = this->find_property(edge);
+
+        if(property == nullptr)
             throw std::out_of_range("Property not found for edge");
-        }
+
+        return *property;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    const typename graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            vertex_property_type *
+            graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+                    find_property(const vertex_type & vertex) const
+    {
+        const property_entry * properties = this->find_properties(vertex);
+
+        return properties == nullptr || !properties->property ? nullptr : &*properties->property;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    const typename graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            edge_property_type *
+            graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+                    find_property(const edge_type & edge) const
+    {
+        const property_entry * properties = this->find_properties(edge.source());
+
+        if(properties == nullptr)
+            return nullptr;
+
+        auto it = properties->edge_properties.find(edge);
+
+        return it == properties->edge_properties.end() ? nullptr : &it->second;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    void graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::set_property(
+            const vertex_type & vertex,
+            const vertex_property_type & property)
+    {
+        this->mutable_properties(vertex).property = property;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    void graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::set_property(
+            const edge_type & edge,
+            const edge_property_type & property)
+    {
+        this->validate(edge, true);
+        this->mutable_properties(edge.source()).edge_properties.insert_or_assign(edge, property);
     }
 
     template <typename VertexId,
@@ -316,7 +609,11 @@ namespace internal
     bool graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::add_vertex(
             const vertex_type & vertex)
     {
-        return graph_map.emplace(vertex, std::unordered_set<edge_type>()).second;
+        if(this->graph_map->find(vertex) != this->graph_map->end())
+            return false;
+
+        this->mutable_map().emplace(vertex, this->new_entry(vertex));
+        return true;
     }
 
     template <typename VertexId,
@@ -328,7 +625,7 @@ namespace internal
             add_edge_to_source(const edge_type & edge)
     {
         this->validate(edge, false);
-        this->graph_map.at(edge.source()).insert(edge);
+        this->mutable_entry(edge.source()).edges.insert(edge);
     }
 
     template <typename VertexId,
@@ -340,7 +637,7 @@ namespace internal
             add_edge_to_destination(const edge_type & edge)
     {
         this->validate(edge, false);
-        this->graph_map.at(edge.destination()).insert(edge);
+        this->mutable_entry(edge.destination()).edges.insert(edge);
     }
 
     template <typename VertexId,
@@ -348,11 +645,219 @@ namespace internal
             typename Edge,
             typename VertexProperty,
             typename EdgeProperty>
-    void graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::validate(
-            const vertex_type & vertex) const
+    void graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            add_incoming_edge(const edge_type & edge)
+    {
+        this->validate(edge, false);
+        this->mutable_entry(edge.destination()).incoming_edges.insert(edge);
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    void graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::reserve_edges(
+            const vertex_type & vertex,
+            size_t edges_count)
+    {
+        this->unshared_entry(vertex).edges.reserve(edges_count);
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    void graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            add_edge_unchecked(const edge_type & edge, bool to_destination)
+    {
+        this->unshared_entry(edge.source()).edges.insert(edge);
+
+        if(to_destination)
+            this->unshared_entry(edge.destination()).edges.insert(edge);
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    void graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            set_property_unchecked(const edge_type & edge, const edge_property_type & property)
+    {
+        this->mutable_properties(edge.source()).edge_properties.insert_or_assign(edge, property);
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    const typename graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            vertex_entry &
+            graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::entry(
+                    const vertex_type & vertex) const
     {
-        if(this->graph_map.find(vertex) == this->graph_map.end())
+        auto it = this->graph_map->find(vertex);
+
+        if(it == this->graph_map->end())
             throw std::invalid_argument("Vertex does not belong to the graph");
+
+        return *it->second;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    const typename graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            property_entry *
+            graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+                    find_properties(const vertex_type & vertex) const
+    {
+        auto it = this->property_map->find(vertex);
+
+        return it == this->property_map->end() ? nullptr : it->second.get();
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    typename graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            vertex_entry &
+            graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+                    mutable_entry(const vertex_type & vertex)
+    {
+        this->entry(vertex);
+        return this->unshared_entry(vertex);
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    typename graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            vertex_entry &
+            graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+                    unshared_entry(const vertex_type & vertex)
+    {
+        std::shared_ptr<vertex_entry> & entry = this->mutable_map().find(vertex)->second;
+
+        if(entry.use_count() > 1)
+            entry = this->copy_entry(*entry);
+        else
+            // synchronises with release of the entry by other owners, so their reads are done
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+        return *entry;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    typename graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            property_entry &
+            graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+                    mutable_properties(const vertex_type & vertex)
+    {
+        this->entry(vertex);
+
+        std::shared_ptr<property_entry> & entry =
+                this->mutable_property_map().emplace(vertex, nullptr).first->second;
+
+        if(entry == nullptr)
+            entry = std::allocate_shared<property_entry>(
+                    std::pmr::polymorphic_allocator<property_entry>(this->resource_),
+                    this->resource_);
+        else if(entry.use_count() > 1)
+            entry = this->copy_properties(*entry);
+        else
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+        return *entry;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    typename graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            entry_map &
+            graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+                    mutable_map()
+    {
+        // copied map shares all entries, so they are copied later only when modified
+        if(this->graph_map.use_count() > 1)
+            this->graph_map = std::allocate_shared<entry_map>(
+                    std::pmr::polymorphic_allocator<entry_map>(this->resource_), *this->graph_map);
+        else
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+        return *this->graph_map;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    typename graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            properties_map &
+            graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+                    mutable_property_map()
+    {
+        if(this->property_map.use_count() > 1)
+            this->property_map = std::allocate_shared<properties_map>(
+                    std::pmr::polymorphic_allocator<properties_map>(this->resource_),
+                    *this->property_map);
+        else
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+        return *this->property_map;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    typename graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            property_entry &
+            graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+                    exposed_properties(const vertex_type & vertex)
+    {
+        property_entry & entry = this->mutable_properties(vertex);
+
+        if(!entry.exposed)
+        {
+            entry.exposed = true;
+            ++this->exposed_count;
+        }
+
+        return entry;
+    }
+
+    template <typename VertexId,
+            typename Vertex,
+            typename Edge,
+            typename VertexProperty,
+            typename EdgeProperty>
+    void graph_representation<VertexId, Vertex, Edge, VertexProperty, EdgeProperty>::
+            copy_exposed()
+    {
+        // shares adjacency and the other property entries, but not the ones that may be written
+        // through references
+        for(auto && entry : this->mutable_property_map())
+            if(entry.second->exposed)
+                entry.second = this->copy_properties(*entry.second);
     }
 
     template <typename VertexId,
@@ -364,21 +869,23 @@ namespace internal
             const edge_type & edge,
             bool existing) const
     {
-        if(this->graph_map.find(edge.source()) == this->graph_map.end()
-                || this->graph_map.find(edge.destination()) == this->graph_map.end())
+        auto source_it = this->graph_map->find(edge.source());
+        auto destination_it = this->graph_map->find(edge.destination());
+
+        if(source_it == this->graph_map->end() || destination_it == this->graph_map->end())
             throw std::invalid_argument("Edge does not belong to the graph");
 
-        if(existing
-                && this->graph_map.at(edge.source()).find(edge)
-                           == this->graph_map.at(edge.source()).end()
-                && this->graph_map.at(edge.destination()).find(edge)
-                           == this->graph_map.at(edge.destination()).end())
+        if(existing && source_it->second->edges.find(edge) == source_it->second->edges.end()
+                && destination_it->second->edges.find(edge) == destination_it->second->edges.end())
             throw std::invalid_argument("Edge does not belong to the graph");
     }
 }
 
 namespace algolib::graphs
 {
+    template <typename Graph>
+    class graph_builder;
+
     template <typename VertexId, typename VertexProperty, typename EdgeProperty>
     class simple_graph : public virtual graph<VertexId, VertexProperty, EdgeProperty>
     {
@@ -403,13 +910,23 @@ namespace algolib::graphs
         class graph_properties_impl;
 
     public:
-        explicit simple_graph(const std::vector<vertex_id_type> & vertex_ids = {})
-            : representation{vertex_ids}, graph_properties_{*this}
+        explicit simple_graph(const std::vector<vertex_id_type> & vertex_ids = {},
+                std::pmr::memory_resource * resource = std::pmr::get_default_resource())
+            : representation{vertex_ids, resource}, graph_properties_{*this}
         {
         }
 
         ~simple_graph() override = default;
 
+        /*!
+         * \brief Creates a snapshot of given graph.
+         * The snapshot shares structure with the graph, which is copied lazily only in parts
+         * modified later. Properties of vertices accessed for writing are copied at once, since
+         * the graph may still be modified through such references, while adjacency stays shared;
+         * otherwise copying takes constant time. A snapshot may be read on another thread while
+         * the graph is modified.
+         * \param graph the graph
+         */
         simple_graph(const simple_graph & graph)
             : representation{graph.representation}, graph_properties_{*this}
         {
@@ -422,15 +939,14 @@ namespace algolib::graphs
 
         simple_graph & operator=(const simple_graph & graph)
         {
-            representation = graph.representation;
-            graph_properties_ = graph_properties_impl(*this);
+            // properties keep referring to this graph
+            this->representation = graph.representation;
             return *this;
         }
 
         simple_graph & operator=(simple_graph && graph)
         {
-            representation = std::move(graph.representation);
-            graph_properties_ = graph_properties_impl(*this);
+            this->representation = std::move(graph.representation);
             return *this;
         }
 
@@ -451,12 +967,28 @@ namespace algolib::graphs
             return this->representation[vertex_id];
         }
 
+        /*!
+         * \brief Gets the edge between vertices of given identifiers.
+         * Edges are kept in flat hash tables of their vertices, so the reference is invalidated by
+         * any later insertion of an edge into the same vertex, and by any modification of the
+         * vertex after the graph was copied.
+         * \param vertices the identifiers of source and destination vertices
+         * \return the edge between the vertices
+         * \throw std::out_of_range if no such edge exists
+         */
         const edge_type & operator[](
                 const std::pair<vertex_id_type, vertex_id_type> & vertices) const override
         {
             return this->representation[vertices];
         }
 
+        /*!
+         * \brief Gets the edge between given vertices.
+         * The reference is invalidated just as for edges got by identifiers of vertices.
+         * \param vertices the source and destination vertices
+         * \return the edge between the vertices
+         * \throw std::out_of_range if no such edge exists
+         */
         const edge_type & operator[](
                 const std::pair<vertex_type, vertex_type> & vertices) const override
         {
@@ -480,6 +1012,36 @@ namespace algolib::graphs
 
         std::vector<vertex_type> neighbours(const vertex_type & vertex) const override;
 
+        void for_each_neighbour(const vertex_type & vertex,
+                internal::function_ref<void(const vertex_type &)> function) const override
+        {
+            this->representation.for_each_adjacent_edge(
+                    vertex, [&](const edge_type & edge) { function(edge.get_neighbour(vertex)); });
+        }
+
+        bool any_neighbour(const vertex_type & vertex,
+                internal::function_ref<bool(const vertex_type &)> function) const override
+        {
+            return this->representation.any_adjacent_edge(vertex,
+                    [&](const edge_type & edge) { return function(edge.get_neighbour(vertex)); });
+        }
+
+        void for_each_adjacent_edge(const vertex_type & vertex,
+                internal::function_ref<void(const edge_type &)> function) const override
+        {
+            this->representation.for_each_adjacent_edge(vertex, function);
+        }
+
+        /*!
+         * \brief Gets the memory resource that all structures of this graph are allocated from.
+         * Copies of the graph share its structure, so they keep its memory resource.
+         * \return the memory resource of this graph
+         */
+        std::pmr::memory_resource * resource() const
+        {
+            return this->representation.resource();
+        }
+
         vertex_type add_vertex(const vertex_id_type & vertex_id);
         vertex_type add_vertex(const vertex_id_type & vertex_id,
                 const vertex_property_type & property);
@@ -554,7 +1116,7 @@ namespace algolib::graphs
 
         if(was_added)
         {
-            this->representation.property(vertex) = property;
+            this->representation.set_property(vertex, property);
             return vertex;
         }
 
@@ -608,7 +1170,7 @@ namespace algolib::graphs
                 const vertex_type & vertex)
                 const override
         {
-            return graph.representation.property_at(vertex);
+            return std::as_const(graph.representation).property_at(vertex);
         }
 
         edge_property_type & operator[](
@@ -629,7 +1191,7 @@ namespace algolib::graphs
                 const edge_type & edge)
                 const override
         {
-            return graph.representation.property_at(edge);
+            return std::as_const(graph.representation).property_at(edge);
         }
 
     private:
@@ -7,11 +7,241 @@
 
 #include <cstdlib>
 #include <algorithm>
+#include <atomic>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
 #include <vector>
+#include "algolib/graphs/flat_hash.hpp"
 #include "algolib/graphs/undirected_graph.hpp"
 
 namespace algolib::graphs
 {
+    /*!
+     * \brief Immutable view of tree graph rooted in given vertex.
+     * Vertices are numbered in pre-order, so each subtree occupies a contiguous range of indices
+     * starting at its root. All arrays are indexed by these numbers.
+     */
+    template <typename VertexId>
+    class rooted_tree
+    {
+    public:
+        using vertex_id_type = VertexId;
+        using vertex_type = vertex<VertexId>;
+        using edge_type = edge<VertexId>;
+
+        /*!
+         * \param graph the tree graph
+         * \param root the root vertex
+         * \throw std::invalid_argument if the root does not belong to the graph
+         */
+        template <typename VertexProperty, typename EdgeProperty>
+        rooted_tree(const graph<VertexId, VertexProperty, EdgeProperty> & graph,
+                const vertex_type & root);
+
+        ~rooted_tree() = default;
+        rooted_tree(const rooted_tree &) = default;
+        rooted_tree(rooted_tree &&) = default;
+        rooted_tree & operator=(const rooted_tree &) = default;
+        rooted_tree & operator=(rooted_tree &&) = default;
+
+        const vertex_type & root() const
+        {
+            return this->vertices_[0];
+        }
+
+        size_t size() const
+        {
+            return this->vertices_.size();
+        }
+
+        /*!
+         * \brief Gets the pre-order number of given vertex.
+         * \param vertex the vertex
+         * \return the index of the vertex
+         * \throw std::out_of_range if the vertex does not belong to the tree
+         */
+        size_t index(const vertex_type & vertex) const
+        {
+            return this->indices.at(vertex);
+        }
+
+        //! \return the vertices in pre-order
+        const std::vector<vertex_type> & vertices() const
+        {
+            return this->vertices_;
+        }
+
+        //! \return the indices of parents of vertices; the root is its own parent
+        const std::vector<size_t> & parents() const
+        {
+            return this->parents_;
+        }
+
+        //! \return the distances of vertices from the root in edges
+        const std::vector<size_t> & depths() const
+        {
+            return this->depths_;
+        }
+
+        //! \return the numbers of vertices in subtrees of vertices
+        const std::vector<size_t> & subtree_sizes() const
+        {
+            return this->subtree_sizes_;
+        }
+
+        //! \return the post-order numbers of vertices
+        const std::vector<size_t> & post_orders() const
+        {
+            return this->post_orders_;
+        }
+
+        //! \return the indices of vertices as visited by the Euler tour, of length 2n - 1
+        const std::vector<size_t> & euler_tour() const
+        {
+            return this->euler_tour_;
+        }
+
+        //! \return the positions of first occurrences of vertices in the Euler tour
+        const std::vector<size_t> & first_occurrences() const
+        {
+            return this->first_occurrences_;
+        }
+
+        vertex_type parent(const vertex_type & vertex) const
+        {
+            return this->vertices_[this->parents_[this->index(vertex)]];
+        }
+
+        /*!
+         * \brief Gets the edge between given vertex and its parent.
+         * \param vertex the vertex
+         * \return the edge to the parent
+         * \throw std::invalid_argument if the vertex is the root
+         */
+        const edge_type & parent_edge(const vertex_type & vertex) const
+        {
+            return this->parent_edge(this->index(vertex));
+        }
+
+        const edge_type & parent_edge(size_t index) const
+        {
+            if(index == 0)
+                throw std::invalid_argument("Root has no parent edge");
+
+            return this->parent_edges[index - 1];
+        }
+
+        size_t depth(const vertex_type & vertex) const
+        {
+            return this->depths_[this->index(vertex)];
+        }
+
+        size_t subtree_size(const vertex_type & vertex) const
+        {
+            return this->subtree_sizes_[this->index(vertex)];
+        }
+
+        /*!
+         * \brief Checks whether one vertex lies in the subtree of another.
+         * \param ancestor the presumed ancestor
+         * \param vertex the presumed offspring
+         * \return \c true if the vertex is in the subtree of the ancestor, otherwise \c false
+         */
+        bool is_ancestor(const vertex_type & ancestor, const vertex_type & vertex) const
+        {
+            return this->is_ancestor(this->index(ancestor), this->index(vertex));
+        }
+
+        bool is_ancestor(size_t ancestor_index, size_t index) const
+        {
+            return ancestor_index <= index
+                   && index < ancestor_index + this->subtree_sizes_[ancestor_index];
+        }
+
+    private:
+        std::vector<vertex_type> vertices_;
+        internal::flat_hash_map<vertex_type, size_t> indices;
+        std::vector<size_t> parents_;
+        // edges to parents of all vertices except the root
+        std::vector<edge_type> parent_edges;
+        std::vector<size_t> depths_;
+        std::vector<size_t> subtree_sizes_;
+        std::vector<size_t> post_orders_;
+        std::vector<size_t> euler_tour_;
+        std::vector<size_t> first_occurrences_;
+    };
+
+    template <typename VertexId>
+    template <typename VertexProperty, typename EdgeProperty>
+    rooted_tree<VertexId>::rooted_tree(const graph<VertexId, VertexProperty, EdgeProperty> & graph,
+            const vertex_type & root)
+    {
+        struct frame
+        {
+            size_t index;
+            std::vector<edge_type> edges;
+            size_t next;
+        };
+
+        size_t vertices_count = graph.vertices_count();
+        size_t post_order = 0;
+        std::vector<frame> frames;
+
+        this->vertices_.reserve(vertices_count);
+        this->indices.reserve(vertices_count);
+        this->parents_.reserve(vertices_count);
+        this->depths_.reserve(vertices_count);
+        this->subtree_sizes_.resize(vertices_count);
+        this->post_orders_.resize(vertices_count);
+        this->euler_tour_.reserve(2 * vertices_count);
+        this->first_occurrences_.reserve(vertices_count);
+
+        // iterative DFS, so deep trees do not exhaust the call stack
+        auto enter = [&](const vertex_type & vertex, size_t parent, size_t depth)
+        {
+            size_t index = this->vertices_.size();
+
+            this->vertices_.push_back(vertex);
+            this->indices.emplace(vertex, index);
+            this->parents_.push_back(parent);
+            this->depths_.push_back(depth);
+            this->first_occurrences_.push_back(this->euler_tour_.size());
+            this->euler_tour_.push_back(index);
+            frames.push_back(frame{index, graph.adjacent_edges(vertex), 0});
+        };
+
+        enter(root, 0, 0);
+
+        while(!frames.empty())
+        {
+            frame & top = frames.back();
+
+            if(top.next < top.edges.size())
+            {
+                const edge_type edge = top.edges[top.next++];
+                size_t index = top.index;
+                vertex_type neighbour = edge.get_neighbour(this->vertices_[index]);
+
+                if(index != 0 && neighbour == this->vertices_[this->parents_[index]])
+                    continue;
+
+                this->parent_edges.push_back(edge);
+                enter(neighbour, index, this->depths_[index] + 1);
+                continue;
+            }
+
+            size_t index = top.index;
+
+            frames.pop_back();
+            this->subtree_sizes_[index] = this->vertices_.size() - index;
+            this->post_orders_[index] = post_order++;
+
+            if(!frames.empty())
+                this->euler_tour_.push_back(frames.back().index);
+        }
+    }
+
     template <typename VertexId = size_t,
             typename VertexProperty = std::nullptr_t,
             typename EdgeProperty = std::nullptr_t>
@@ -36,7 +266,13 @@ namespace algolib::graphs
                 undirected_simple_graph<vertex_id_type, vertex_property_type, edge_property_type>;
 
     public:
-        explicit tree_graph(const vertex_id_type & vertex_id) : graph{graph_t({vertex_id})}
+        /*!
+         * \param vertex_id the identifier of the first vertex
+         * \param resource the memory resource to allocate all structures of this graph from
+         */
+        explicit tree_graph(const vertex_id_type & vertex_id,
+                std::pmr::memory_resource * resource = std::pmr::get_default_resource())
+            : graph{graph_t({vertex_id}, resource)}
         {
         }
 
@@ -105,6 +341,24 @@ namespace algolib::graphs
             return this->graph.neighbours(vertex);
         }
 
+        void for_each_neighbour(const vertex_type & vertex,
+                internal::function_ref<void(const vertex_type &)> function) const override
+        {
+            this->graph.for_each_neighbour(vertex, function);
+        }
+
+        bool any_neighbour(const vertex_type & vertex,
+                internal::function_ref<bool(const vertex_type &)> function) const override
+        {
+            return this->graph.any_neighbour(vertex, function);
+        }
+
+        void for_each_adjacent_edge(const vertex_type & vertex,
+                internal::function_ref<void(const edge_type &)> function) const override
+        {
+            this->graph.for_each_adjacent_edge(vertex, function);
+        }
+
         size_t output_degree(const vertex_type & vertex) const override
         {
             return this->graph.output_degree(vertex);
@@ -121,6 +375,25 @@ namespace algolib::graphs
             return this->graph.as_directed();
         }
 
+        /*!
+         * \brief Gets the view of this tree rooted in given vertex.
+         * The view is computed once and kept until a vertex is added or another root is requested.
+         * \param root the root vertex
+         * \return the rooted view
+         * \throw std::invalid_argument if the root does not belong to this tree
+         */
+        std::shared_ptr<const rooted_tree<VertexId>> rooted(const vertex_type & root) const;
+
+        /*!
+         * \brief Gets the version of this tree, which changes whenever a vertex is added.
+         * Rooted views of the same version stay up to date, so they may be kept by their users.
+         * \return the version of this tree
+         */
+        size_t version() const
+        {
+            return this->version_;
+        }
+
         edge_type add_vertex(const vertex_id_type & vertex, const vertex_type & neighbour);
         edge_type add_vertex(const vertex_id_type & vertex,
                 const vertex_type & neighbour,
@@ -133,9 +406,33 @@ namespace algolib::graphs
                 const edge_property_type & edge_property);
 
     private:
+        void invalidate_rooted()
+        {
+            ++this->version_;
+            std::atomic_store(&this->rooted_view, std::shared_ptr<const rooted_tree<VertexId>>());
+        }
+
         graph_t graph;
+        size_t version_ = 0;
+        // last computed rooted view, shared between copies until a vertex is added
+        mutable std::shared_ptr<const rooted_tree<VertexId>> rooted_view;
     };
 
+    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
+    std::shared_ptr<const rooted_tree<VertexId>>
+            tree_graph<VertexId, VertexProperty, EdgeProperty>::rooted(
+                    const vertex_type & root) const
+    {
+        std::shared_ptr<const rooted_tree<VertexId>> view = std::atomic_load(&this->rooted_view);
+
+        if(view != nullptr && view->root() == root)
+            return view;
+
+        view = std::make_shared<const rooted_tree<VertexId>>(this->graph, root);
+        std::atomic_store(&this->rooted_view, view);
+        return view;
+    }
+
     template <typename VertexId, typename VertexProperty, typename EdgeProperty>
     typename tree_graph<VertexId, VertexProperty, EdgeProperty>::edge_type
             tree_graph<VertexId, VertexProperty, EdgeProperty>::add_vertex(
@@ -168,6 +465,8 @@ namespace algolib::graphs
     {
         vertex_type new_vertex = this->graph.add_vertex(vertex);
 
+        this->invalidate_rooted();
+
         return this->graph.add_edge_between(new_vertex, neighbour);
     }
 
@@ -183,6 +482,8 @@ namespace algolib::graphs
     {
         vertex_type new_vertex = this->graph.add_vertex(vertex, vertex_property);
 
+        this->invalidate_rooted();
+
         return this->graph.add_edge_between(new_vertex, neighbour, edge_property);
     }
 }
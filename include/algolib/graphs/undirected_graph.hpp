@@ -6,14 +6,119 @@
 #define UNDIRECTED_GRAPH_HPP_
 
 #include <algorithm>
+#include <atomic>
 #include <exception>
+#include <memory>
+#include <memory_resource>
 #include <optional>
 #include <stdexcept>
-#include <unordered_set>
+#include <utility>
 #include <vector>
 #include "algolib/graphs/directed_graph.hpp"
 #include "algolib/graphs/simple_graph.hpp"
 
+namespace internal
+{
+    /*
+     * Append-only list of edges kept in chunks of fixed size, with copy-on-write structural
+     * sharing. Copies share the chunks, and full chunks never change, so an append after copying
+     * copies the vector of pointers to chunks and at most the last chunk.
+     */
+    template <typename Edge>
+    class edge_chunk_list
+    {
+    public:
+        explicit edge_chunk_list(std::pmr::memory_resource * resource)
+            : resource{resource}, chunks{this->new_chunks()}
+        {
+        }
+
+        ~edge_chunk_list() = default;
+        edge_chunk_list(const edge_chunk_list &) = default;
+
+        // moved-from list is left empty, but still usable
+        edge_chunk_list(edge_chunk_list && list)
+            : resource{list.resource},
+              chunks{std::exchange(list.chunks, list.new_chunks())},
+              size_{std::exchange(list.size_, 0)}
+        {
+        }
+
+        edge_chunk_list & operator=(const edge_chunk_list &) = default;
+
+        edge_chunk_list & operator=(edge_chunk_list && list)
+        {
+            if(this != &list)
+            {
+                this->resource = list.resource;
+                this->chunks = std::exchange(list.chunks, list.new_chunks());
+                this->size_ = std::exchange(list.size_, 0);
+            }
+
+            return *this;
+        }
+
+        size_t size() const
+        {
+            return this->size_;
+        }
+
+        std::vector<Edge> to_vector() const
+        {
+            std::vector<Edge> result;
+
+            result.reserve(this->size_);
+
+            for(auto && chunk : *this->chunks)
+                result.insert(result.end(), chunk->begin(), chunk->end());
+
+            return result;
+        }
+
+        void push_back(const Edge & edge);
+
+    private:
+        using chunk = std::pmr::vector<Edge>;
+        using chunk_vector = std::pmr::vector<std::shared_ptr<chunk>>;
+
+        static constexpr size_t chunk_size = 256;
+
+        std::shared_ptr<chunk_vector> new_chunks() const
+        {
+            return std::allocate_shared<chunk_vector>(
+                    std::pmr::polymorphic_allocator<chunk_vector>(this->resource));
+        }
+
+        std::pmr::memory_resource * resource;
+        std::shared_ptr<chunk_vector> chunks;
+        size_t size_ = 0;
+    };
+
+    template <typename Edge>
+    void edge_chunk_list<Edge>::push_back(const Edge & edge)
+    {
+        if(this->chunks.use_count() > 1)
+            this->chunks = std::allocate_shared<chunk_vector>(
+                    std::pmr::polymorphic_allocator<chunk_vector>(this->resource), *this->chunks);
+        else
+            // synchronises with release of the chunks by other owners, so their reads are done
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+        if(this->chunks->empty() || this->chunks->back()->size() == chunk_size)
+            this->chunks->push_back(std::allocate_shared<chunk>(
+                    std::pmr::polymorphic_allocator<chunk>(this->resource)));
+        else if(this->chunks->back().use_count() > 1)
+            this->chunks->back() = std::allocate_shared<chunk>(
+                    std::pmr::polymorphic_allocator<chunk>(this->resource),
+                    *this->chunks->back());
+        else
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+        this->chunks->back()->push_back(edge);
+        ++this->size_;
+    }
+}
+
 namespace algolib::graphs
 {
     template <typename VertexId, typename VertexProperty, typename EdgeProperty>
@@ -31,6 +136,11 @@ namespace algolib::graphs
         ~undirected_graph() override = default;
     };
 
+    template <typename VertexId = size_t,
+            typename VertexProperty = std::nullptr_t,
+            typename EdgeProperty = std::nullptr_t>
+    class undirected_frozen_graph;
+
     template <typename VertexId = size_t,
             typename VertexProperty = std::nullptr_t,
             typename EdgeProperty = std::nullptr_t>
@@ -53,81 +163,91 @@ namespace algolib::graphs
         using repr = typename simple_graph<VertexId, VertexProperty, EdgeProperty>::repr;
 
     public:
-        explicit undirected_simple_graph(const std::vector<vertex_id_type> & vertex_ids = {})
-            : simple_graph<VertexId, VertexProperty, EdgeProperty>(vertex_ids)
+        /*!
+         * \param vertex_ids the identifiers of initial vertices
+         * \param resource the memory resource to allocate all structures of this graph from
+         */
+        explicit undirected_simple_graph(const std::vector<vertex_id_type> & vertex_ids = {},
+                std::pmr::memory_resource * resource = std::pmr::get_default_resource())
+            : simple_graph<VertexId, VertexProperty, EdgeProperty>(vertex_ids, resource),
+              edge_list{resource}
         {
         }
 
         ~undirected_simple_graph() override = default;
         undirected_simple_graph(const undirected_simple_graph &) = default;
-        undirected_simple_graph(undirected_simple_graph &&) = default;
+
+        // moved-from graph is left empty, but still usable
+        undirected_simple_graph(undirected_simple_graph && graph)
+            : simple_graph<VertexId, VertexProperty, EdgeProperty>(std::move(graph)),
+              edge_list{std::move(graph.edge_list)}
+        {
+        }
+
         undirected_simple_graph & operator=(const undirected_simple_graph &) = default;
-        undirected_simple_graph & operator=(undirected_simple_graph &&) = default;
+
+        undirected_simple_graph & operator=(undirected_simple_graph && graph)
+        {
+            if(this != &graph)
+            {
+                simple_graph<VertexId, VertexProperty, EdgeProperty>::operator=(std::move(graph));
+                this->edge_list = std::move(graph.edge_list);
+            }
+
+            return *this;
+        }
 
         size_t output_degree(const vertex_type & vertex) const override
         {
-            return this->representation.adjacent_edges(vertex).size();
+            return this->representation.adjacent_edges_count(vertex);
         }
 
         size_t input_degree(const vertex_type & vertex) const override
         {
-            return this->representation.adjacent_edges(vertex).size();
+            return this->representation.adjacent_edges_count(vertex);
+        }
+
+        size_t edges_count() const override
+        {
+            return this->edge_list.size();
+        }
+
+        std::vector<edge_type> edges() const override
+        {
+            return this->edge_list.to_vector();
         }
 
-        size_t edges_count() const override;
-        std::vector<edge_type> edges() const override;
         edge_type add_edge(const edge_type & edge) override;
         edge_type add_edge(const edge_type & edge, const edge_property_type & property) override;
         directed_simple_graph<vertex_id_type, vertex_property_type, edge_property_type>
                 as_directed() const;
-    };
 
-    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
-    size_t undirected_simple_graph<VertexId, VertexProperty, EdgeProperty>::edges_count() const
-    {
-        auto edges_set = this->representation.edges_set();
-        std::unordered_set<edge_type> all_edges;
+        /*!
+         * \brief Creates immutable compressed sparse row copy of this graph.
+         * Defined in frozen_graph.hpp, which has to be included to call it.
+         * \return the frozen copy of this graph
+         */
+        undirected_frozen_graph<VertexId, VertexProperty, EdgeProperty> freeze() const;
 
-        std::for_each(edges_set.begin(), edges_set.end(),
-                [&](auto && edge_set)
-                {
-                    std::copy(edge_set.begin(), edge_set.end(),
-                            std::inserter(all_edges, all_edges.end()));
-                });
-
-        return all_edges.size();
-    }
-
-    template <typename VertexId, typename VertexProperty, typename EdgeProperty>
-    std::vector<typename undirected_simple_graph<VertexId, VertexProperty, EdgeProperty>::edge_type>
-            undirected_simple_graph<VertexId, VertexProperty, EdgeProperty>::edges() const
-    {
-        auto && edges_set = this->representation.edges_set();
-        std::unordered_set<edge_type> all_edges;
+    private:
+        template <typename Graph>
+        friend class graph_builder;
 
-        std::for_each(edges_set.begin(), edges_set.end(),
-                [&](auto && edge_set)
-                {
-                    std::copy(edge_set.begin(), edge_set.end(),
-                            std::inserter(all_edges, all_edges.end()));
-                });
-
-        return std::vector<edge_type>(all_edges.begin(), all_edges.end());
-    }
+        // every edge once, in the direction it was added; shared between copies until modified
+        internal::edge_chunk_list<edge_type> edge_list;
+    };
 
     template <typename VertexId, typename VertexProperty, typename EdgeProperty>
     typename undirected_simple_graph<VertexId, VertexProperty, EdgeProperty>::edge_type
             undirected_simple_graph<VertexId, VertexProperty, EdgeProperty>::add_edge(
                     const edge_type & edge)
-    try
-    {
-        this->operator[](std::make_pair(edge.source(), edge.destination()));
-        throw std::invalid_argument("Edge already exists");
-    }
-    catch(const std::out_of_range &)
     {
+        if(this->representation.find_edge(edge.source().id(), edge.destination().id()) != nullptr)
+            throw std::invalid_argument("Edge already exists");
+
         this->representation.add_edge_to_source(edge);
         this->representation.add_edge_to_destination(edge);
+        this->edge_list.push_back(edge);
         return edge;
     }
 
@@ -136,16 +256,9 @@ namespace algolib::graphs
             undirected_simple_graph<VertexId, VertexProperty, EdgeProperty>::add_edge(
                     const edge_type & edge,
                     const edge_property_type & property)
-    try
     {
-        this->operator[](std::make_pair(edge.source(), edge.destination()));
-        throw std::invalid_argument("Edge already exists");
-    }
-    catch(const std::out_of_range &)
-    {
-        this->representation.add_edge_to_source(edge);
-        this->representation.add_edge_to_destination(edge);
-        this->representation.property(edge) = property;
+        this->add_edge(edge);
+        this->representation.set_property(edge, property);
         return edge;
     }
 
@@ -158,23 +271,19 @@ namespace algolib::graphs
                     edge_property_type>
             undirected_simple_graph<VertexId, VertexProperty, EdgeProperty>::as_directed() const
     {
-        std::vector<vertex_type> all_vertices = this->vertices();
-        std::vector<vertex_id_type> vertex_ids;
-
-        std::transform(all_vertices.begin(), all_vertices.end(), std::back_inserter(vertex_ids),
-                [](auto && vertex) { return vertex.id(); });
-
         directed_simple_graph<vertex_id_type, vertex_property_type, edge_property_type> graph(
-                vertex_ids);
+                {}, this->resource());
 
-        for(auto && vertex : all_vertices)
-            try
-            {
-                graph.properties()[vertex] = this->properties().at(vertex);
-            }
-            catch(const std::out_of_range &)
-            {
-            }
+        // properties are set when adding, so no references to them are handed out
+        for(auto && vertex : this->vertices())
+        {
+            const vertex_property_type * property = this->representation.find_property(vertex);
+
+            if(property != nullptr)
+                graph.add_vertex(vertex, *property);
+            else
+                graph.add_vertex(vertex);
+        }
 
         for(auto && edge : this->edges())
         {
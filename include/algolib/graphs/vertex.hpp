@@ -7,6 +7,7 @@
 
 #include <cstdlib>
 #include <iostream>
+#include "algolib/graphs/flat_hash.hpp"
 
 namespace algolib::graphs
 {
@@ -135,7 +136,7 @@ namespace std
 
         result_type operator()(const argument_type & vertex) const
         {
-            return std::hash<VertexId>()(vertex.id_);
+            return internal::mix_hash(std::hash<VertexId>()(vertex.id_));
         }
     };
 
@@ -151,7 +152,7 @@ namespace std
             result_type first_hash = std::hash<element_type>()(pair.first);
             result_type second_hash = std::hash<element_type>()(pair.second);
 
-            return first_hash ^ (second_hash + 0x9e3779b9 + (first_hash << 6) + (first_hash >> 2));
+            return internal::combine_hash(first_hash, second_hash);
         }
     };
 }
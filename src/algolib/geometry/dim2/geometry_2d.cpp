@@ -3,6 +3,7 @@
  * \brief Algorithms for basic geometrical operations in 2D.
  */
 #include "algolib/geometry/dim2/geometry_2d.hpp"
+#include <cmath>
 #include <algorithm>
 
 namespace alge2 = algolib::geometry::dim2;
@@ -40,6 +41,11 @@ double alge2::distance(const point_2d & point1, const point_2d & point2)
             + (point2.y() - point1.y()) * (point2.y() - point1.y()));
 }
 
+double alge2::manhattan_distance(const point_2d & point1, const point_2d & point2)
+{
+    return std::abs(point2.x() - point1.x()) + std::abs(point2.y() - point1.y());
+}
+
 alge2::point_2d alge2::translate(const point_2d & point, const vector_2d & vector)
 {
     return point_2d(point.x() + vector.x(), point.y() + vector.y());
@@ -3,6 +3,7 @@
  * \brief Algorithms for basic geometrical operations in 3D.
  */
 #include "algolib/geometry/dim3/geometry_3d.hpp"
+#include <cmath>
 #include <algorithm>
 
 namespace alge3 = algolib::geometry::dim3;
@@ -36,6 +37,13 @@ double alge3::distance(const point_3d & point1, const point_3d & point2)
             + (point2.z() - point1.z()) * (point2.z() - point1.z()));
 }
 
+double alge3::manhattan_distance(const point_3d & point1, const point_3d & point2)
+{
+    return std::abs(point2.x() - point1.x())
+           + std::abs(point2.y() - point1.y())
+           + std::abs(point2.z() - point1.z());
+}
+
 alge3::point_3d alge3::translate(const point_3d & point, const vector_3d & vector)
 {
     return point_3d(point.x() + vector.x(), point.y() + vector.y(), point.z() + vector.z());
@@ -0,0 +1,5 @@
+/**!
+ * \file parallel_searching.cpp
+ * \brief Parallel algorithms for graph searching.
+ */
+#include "algolib/graphs/algorithms/parallel_searching.hpp"
@@ -0,0 +1,5 @@
+/**!
+ * \file searching_ranges.cpp
+ * \brief Lazy ranges of vertices in searching order.
+ */
+#include "algolib/graphs/algorithms/searching_ranges.hpp"
@@ -0,0 +1,5 @@
+/*!
+ * \file vertex_map.cpp
+ * \brief Per-vertex state of graph algorithms.
+ */
+#include "algolib/graphs/algorithms/vertex_map.hpp"
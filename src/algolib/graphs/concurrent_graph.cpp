@@ -0,0 +1,5 @@
+/*!
+ * \file concurrent_graph.cpp
+ * \brief Structure of graph shared by concurrent readers and writers.
+ */
+#include "algolib/graphs/concurrent_graph.hpp"
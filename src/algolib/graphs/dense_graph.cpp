@@ -0,0 +1,5 @@
+/*!
+ * \file dense_graph.cpp
+ * \brief Structure of graph with vertices numbered consecutively from zero.
+ */
+#include "algolib/graphs/dense_graph.hpp"
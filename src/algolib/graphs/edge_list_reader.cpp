@@ -0,0 +1,5 @@
+/*!
+ * \file edge_list_reader.cpp
+ * \brief Streaming reading of graph edges from text edge lists.
+ */
+#include "algolib/graphs/edge_list_reader.hpp"
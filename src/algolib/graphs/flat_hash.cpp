@@ -0,0 +1,5 @@
+/*!
+ * \file flat_hash.cpp
+ * \brief Flat open-addressing hash tables and hash mixing for graph structures.
+ */
+#include "algolib/graphs/flat_hash.hpp"
@@ -0,0 +1,5 @@
+/*!
+ * \file frozen_graph.cpp
+ * \brief Structure of immutable graph in compressed sparse row form.
+ */
+#include "algolib/graphs/frozen_graph.hpp"
@@ -0,0 +1,5 @@
+/*!
+ * \file graph_builder.cpp
+ * \brief Bulk construction of simple graphs.
+ */
+#include "algolib/graphs/graph_builder.hpp"
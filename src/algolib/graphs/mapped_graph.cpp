@@ -0,0 +1,88 @@
+/*!
+ * \file mapped_graph.cpp
+ * \brief Structure of read-only graph memory-mapped from binary file.
+ */
+#include "algolib/graphs/mapped_graph.hpp"
+#include <cerrno>
+#include <system_error>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+    constexpr size_t graph_file_alignment = 64;
+
+    size_t align(size_t position)
+    {
+        return (position + graph_file_alignment - 1) / graph_file_alignment
+               * graph_file_alignment;
+    }
+}
+
+internal::graph_file_layout::graph_file_layout(const graph_file_header & header)
+{
+    bool directed = (header.flags & graph_file_directed) != 0;
+    bool weighted = (header.flags & graph_file_weighted) != 0;
+
+    this->vertices = align(sizeof(graph_file_header));
+    this->edges = align(this->vertices + header.vertices_count * header.vertex_size);
+    this->offsets = align(this->edges + header.edges_count * header.edge_size);
+    this->neighbour_indices =
+            align(this->offsets + (header.vertices_count + 1) * sizeof(std::uint64_t));
+    this->edge_indices =
+            align(this->neighbour_indices + header.rows_size * sizeof(std::uint64_t));
+    this->input_offsets = align(this->edge_indices + header.rows_size * sizeof(std::uint64_t));
+    this->input_neighbour_indices = align(
+            this->input_offsets
+            + (directed ? header.vertices_count + 1 : 0) * sizeof(std::uint64_t));
+    this->input_edge_indices =
+            align(this->input_neighbour_indices + header.input_rows_size * sizeof(std::uint64_t));
+    this->weights =
+            align(this->input_edge_indices + header.input_rows_size * sizeof(std::uint64_t));
+    this->size = this->weights + (weighted ? header.edges_count * sizeof(double) : 0);
+}
+
+internal::mapped_file::mapped_file(const std::string & path) : data_{nullptr}, size_{0}
+{
+    int descriptor = ::open(path.c_str(), O_RDONLY);
+
+    if(descriptor < 0)
+        throw std::system_error(errno, std::generic_category(), "Cannot open graph file");
+
+    struct stat status;
+
+    if(::fstat(descriptor, &status) < 0)
+    {
+        int error = errno;
+
+        ::close(descriptor);
+        throw std::system_error(error, std::generic_category(), "Cannot read graph file");
+    }
+
+    this->size_ = static_cast<size_t>(status.st_size);
+
+    if(this->size_ > 0)
+    {
+        void * address = ::mmap(nullptr, this->size_, PROT_READ, MAP_SHARED, descriptor, 0);
+
+        if(address == MAP_FAILED)
+        {
+            int error = errno;
+
+            ::close(descriptor);
+            throw std::system_error(error, std::generic_category(), "Cannot map graph file");
+        }
+
+        this->data_ = static_cast<const char *>(address);
+    }
+
+    ::close(descriptor);
+}
+
+internal::mapped_file::~mapped_file()
+{
+    if(this->data_ != nullptr)
+        ::munmap(const_cast<char *>(this->data_), this->size_);
+}
@@ -3,6 +3,7 @@
  * \brief Algorithms for maximum subarray.
  */
 #include "algolib/sequences/maximum_subarray.hpp"
+#include <cstdlib>
 
 namespace alse = algolib::sequences;
 
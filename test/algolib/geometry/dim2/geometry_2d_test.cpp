@@ -101,6 +101,16 @@ TEST(Geometry2DTest, distance_WhenSamePoint_ThenZero)
     EXPECT_EQ(0.0, result);
 }
 
+TEST(Geometry2DTest, manhattanDistance_WhenDifferentPoints_ThenSumOfCoordinateDifferences)
+{
+    // when
+    double result =
+            alge2::manhattan_distance(alge2::point_2d(4.0, 5.0), alge2::point_2d(-2.0, -3.0));
+
+    // then
+    EXPECT_EQ(14.0, result);
+}
+
 TEST(Geometry2DTest, translate_ThenPointTranslated)
 {
     // when
@@ -86,6 +86,16 @@ TEST(Geometry3DTest, distance_WhenSamePoint_ThenZero)
     EXPECT_EQ(0.0, result);
 }
 
+TEST(Geometry3DTest, manhattanDistance_WhenDifferentPoints_ThenSumOfCoordinateDifferences)
+{
+    // when
+    double result = alge3::manhattan_distance(
+            alge3::point_3d(4.0, 8.0, 5.0), alge3::point_3d(-2.0, -1.0, 3.0));
+
+    // then
+    EXPECT_EQ(17.0, result);
+}
+
 TEST(Geometry3DTest, translate_ThenPointTranslated)
 {
     // when
@@ -95,3 +95,35 @@ TEST_F(LowestCommonAncestorTest, findLca_WhenRootIsOneOfVertices_ThenRoot)
     // then
     EXPECT_EQ(test_object.root(), result);
 }
+
+TEST_F(LowestCommonAncestorTest, findLca_WhenOtherRootsQueried_ThenLowestCommonAncestor)
+{
+    // given
+    algr::lowest_common_ancestor<> other(tree, tree[6]);
+
+    // when
+    vertex_t result1 = test_object.find_lca(tree[7], tree[9]);
+    vertex_t result2 = other.find_lca(tree[7], tree[9]);
+
+    tree.rooted(tree[3]);
+
+    vertex_t result3 = test_object.find_lca(tree[3], tree[7]);
+
+    // then
+    EXPECT_EQ(tree[0], result1);
+    EXPECT_EQ(tree[6], result2);
+    EXPECT_EQ(tree[1], result3);
+}
+
+TEST_F(LowestCommonAncestorTest, findLca_WhenVertexAddedAfterQuery_ThenTreeChangesUsed)
+{
+    // given
+    test_object.find_lca(tree[3], tree[7]);
+    tree.add_vertex(10, tree[7]);
+
+    // when
+    vertex_t result = test_object.find_lca(tree[10], tree[5]);
+
+    // then
+    EXPECT_EQ(tree[1], result);
+}
@@ -56,3 +56,21 @@ TEST(MatchingTest, match_WhenVerticesOnlyInGroup1__ThenEmpty)
     // then
     EXPECT_TRUE(result.empty());
 }
+
+TEST(MatchingTest, match_WhenFreeVertexHasOnlyMatchedNeighbour_ThenMaximalMatching)
+{
+    // given
+    graph_t graph({std::vector<graph_vi>({0, 2}), std::vector<graph_vi>({1, 3, 5})});
+    graph.add_edge_between(graph[1], graph[0]);
+    graph.add_edge_between(graph[1], graph[2]);
+    graph.add_edge_between(graph[3], graph[0]);
+    graph.add_edge_between(graph[5], graph[2]);
+
+    // when
+    std::unordered_map<graph_v, graph_v> result = algr::match(graph);
+
+    // then
+    ASSERT_EQ(4, result.size());
+    EXPECT_EQ(graph[0], result.at(result.at(graph[0])));
+    EXPECT_EQ(graph[2], result.at(result.at(graph[2])));
+}
@@ -0,0 +1,140 @@
+/**!
+ * \file parallel_searching_test.cpp
+ * \brief Tests: Parallel algorithms for graph searching.
+ */
+#include <queue>
+#include <vector>
+#include <gtest/gtest.h>
+#include "algolib/graphs/algorithms/parallel_searching.hpp"
+#include "algolib/graphs/directed_graph.hpp"
+#include "algolib/graphs/undirected_graph.hpp"
+
+namespace algr = algolib::graphs;
+
+class ParallelSearchingTest : public testing::Test
+{
+public:
+    using dgraph_t = algr::directed_simple_graph<>;
+    using ugraph_t = algr::undirected_simple_graph<>;
+
+protected:
+    static constexpr size_t unreached = algr::parallel_bfs_result::unreached;
+
+    dgraph_t directed_graph;
+
+public:
+    ParallelSearchingTest() : directed_graph{dgraph_t({0, 1, 2, 3, 4, 5, 6, 7, 8, 9})}
+    {
+        directed_graph.add_edge_between(directed_graph[0], directed_graph[1]);
+        directed_graph.add_edge_between(directed_graph[1], directed_graph[3]);
+        directed_graph.add_edge_between(directed_graph[1], directed_graph[7]);
+        directed_graph.add_edge_between(directed_graph[3], directed_graph[4]);
+        directed_graph.add_edge_between(directed_graph[4], directed_graph[0]);
+        directed_graph.add_edge_between(directed_graph[5], directed_graph[4]);
+        directed_graph.add_edge_between(directed_graph[5], directed_graph[8]);
+        directed_graph.add_edge_between(directed_graph[6], directed_graph[2]);
+        directed_graph.add_edge_between(directed_graph[6], directed_graph[9]);
+        directed_graph.add_edge_between(directed_graph[8], directed_graph[5]);
+    }
+
+    ~ParallelSearchingTest() override = default;
+};
+
+TEST_F(ParallelSearchingTest, parallelBfs_WhenDirectedGraph_ThenDistancesAndParents)
+{
+    // given
+    auto graph = directed_graph.freeze();
+
+    // when
+    algr::parallel_bfs_result result = algr::parallel_bfs(graph, {graph[1]});
+
+    // then
+    EXPECT_EQ(std::vector<size_t>(
+                      {3, 0, unreached, 1, 2, unreached, unreached, 1, unreached, unreached}),
+            result.distances);
+    EXPECT_EQ(std::vector<size_t>(
+                      {4, 1, unreached, 1, 3, unreached, unreached, 1, unreached, unreached}),
+            result.parents);
+}
+
+TEST_F(ParallelSearchingTest, parallelBfs_WhenManyRoots_ThenDistancesFromNearestRoot)
+{
+    // given
+    auto graph = directed_graph.freeze();
+
+    // when
+    algr::parallel_bfs_result result = algr::parallel_bfs(graph, {graph[8], graph[6]});
+
+    // then
+    EXPECT_EQ(std::vector<size_t>({3, 4, 1, 5, 2, 1, 0, 5, 0, 1}), result.distances);
+    EXPECT_EQ(8, result.parents[8]);
+    EXPECT_EQ(6, result.parents[6]);
+}
+
+TEST_F(ParallelSearchingTest, parallelBfs_WhenLargeUndirectedGraph_ThenSameDistancesAsSequential)
+{
+    // given
+    size_t vertices_count = 50000;
+    std::vector<size_t> vertex_ids;
+
+    for(size_t i = 0; i < vertices_count; ++i)
+        vertex_ids.push_back(i);
+
+    ugraph_t source_graph(vertex_ids);
+
+    for(size_t i = 0; i < vertices_count; ++i)
+    {
+        source_graph.add_edge_between(source_graph[i], source_graph[(i + 1) % vertices_count]);
+
+        if(i % 3 == 0 && i * 7919 % vertices_count > i + 1)
+            source_graph.add_edge_between(source_graph[i], source_graph[i * 7919 % vertices_count]);
+    }
+
+    auto graph = source_graph.freeze();
+    std::vector<size_t> expected(vertices_count, unreached);
+    std::queue<size_t> queue;
+
+    expected[0] = 0;
+    queue.push(0);
+
+    while(!queue.empty())
+    {
+        size_t index = queue.front();
+        auto row = graph.neighbour_indices(index);
+
+        queue.pop();
+
+        for(auto it = row.first; it != row.second; ++it)
+            if(expected[*it] == unreached)
+            {
+                expected[*it] = expected[index] + 1;
+                queue.push(*it);
+            }
+    }
+
+    // when
+    algr::parallel_bfs_result result = algr::parallel_bfs(graph, {graph[0]}, 4);
+
+    // then
+    ASSERT_EQ(expected, result.distances);
+
+    for(size_t i = 1; i < vertices_count; ++i)
+    {
+        auto row = graph.neighbour_indices(i);
+
+        ASSERT_EQ(result.distances[i], result.distances[result.parents[i]] + 1);
+        ASSERT_TRUE(std::binary_search(row.first, row.second, result.parents[i]));
+    }
+}
+
+TEST_F(ParallelSearchingTest, parallelBfs_WhenRootNotInGraph_ThenInvalidArgument)
+{
+    // given
+    auto graph = directed_graph.freeze();
+
+    // when
+    auto exec = [&]() { return algr::parallel_bfs(graph, {dgraph_t::vertex_type(15)}); };
+
+    // then
+    EXPECT_THROW(exec(), std::invalid_argument);
+}
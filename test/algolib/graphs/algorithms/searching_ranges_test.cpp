@@ -0,0 +1,175 @@
+/**!
+ * \file searching_ranges_test.cpp
+ * \brief Tests: Lazy ranges of vertices in searching order.
+ */
+#include <algorithm>
+#include <vector>
+#include <gtest/gtest.h>
+#include "algolib/graphs/algorithms/searching_ranges.hpp"
+#include "algolib/graphs/directed_graph.hpp"
+#include "algolib/graphs/undirected_graph.hpp"
+
+namespace algr = algolib::graphs;
+
+template <typename Vertex>
+struct entries_strategy : public algr::dfs_strategy<Vertex>
+{
+    void for_root(const Vertex &) override
+    {
+    }
+
+    void on_entry(const Vertex & vertex) override
+    {
+        this->entries.push_back(vertex);
+    }
+
+    void on_next_vertex(const Vertex &, const Vertex &) override
+    {
+    }
+
+    void on_exit(const Vertex &) override
+    {
+    }
+
+    void on_edge_to_visited(const Vertex &, const Vertex &) override
+    {
+    }
+
+    std::vector<Vertex> entries;
+};
+
+class SearchingRangesTest : public testing::Test
+{
+public:
+    using dgraph_t = algr::directed_simple_graph<>;
+    using dgraph_v = dgraph_t::vertex_type;
+
+    using ugraph_t = algr::undirected_simple_graph<>;
+    using ugraph_v = ugraph_t::vertex_type;
+
+protected:
+    dgraph_t directed_graph;
+    ugraph_t undirected_graph;
+
+public:
+    SearchingRangesTest()
+        : directed_graph{dgraph_t({0, 1, 2, 3, 4, 5, 6, 7, 8, 9})},
+          undirected_graph{ugraph_t({0, 1, 2, 3, 4, 5, 6, 7, 8, 9})}
+    {
+        directed_graph.add_edge_between(directed_graph[0], directed_graph[1]);
+        directed_graph.add_edge_between(directed_graph[1], directed_graph[3]);
+        directed_graph.add_edge_between(directed_graph[1], directed_graph[7]);
+        directed_graph.add_edge_between(directed_graph[3], directed_graph[4]);
+        directed_graph.add_edge_between(directed_graph[4], directed_graph[0]);
+        directed_graph.add_edge_between(directed_graph[5], directed_graph[4]);
+        directed_graph.add_edge_between(directed_graph[5], directed_graph[8]);
+        directed_graph.add_edge_between(directed_graph[6], directed_graph[2]);
+        directed_graph.add_edge_between(directed_graph[6], directed_graph[9]);
+        directed_graph.add_edge_between(directed_graph[8], directed_graph[5]);
+
+        undirected_graph.add_edge_between(undirected_graph[0], undirected_graph[1]);
+        undirected_graph.add_edge_between(undirected_graph[0], undirected_graph[4]);
+        undirected_graph.add_edge_between(undirected_graph[1], undirected_graph[3]);
+        undirected_graph.add_edge_between(undirected_graph[1], undirected_graph[7]);
+        undirected_graph.add_edge_between(undirected_graph[2], undirected_graph[6]);
+        undirected_graph.add_edge_between(undirected_graph[3], undirected_graph[4]);
+        undirected_graph.add_edge_between(undirected_graph[4], undirected_graph[5]);
+        undirected_graph.add_edge_between(undirected_graph[5], undirected_graph[8]);
+        undirected_graph.add_edge_between(undirected_graph[6], undirected_graph[9]);
+    }
+
+    ~SearchingRangesTest() override = default;
+};
+
+TEST_F(SearchingRangesTest, lazyBfs_ThenSameOrderAsBfs)
+{
+    // given
+    entries_strategy<ugraph_v> strategy;
+    std::vector<ugraph_v> roots = {undirected_graph[0], undirected_graph[6]};
+
+    algr::bfs(undirected_graph, strategy, roots);
+
+    // when
+    std::vector<ugraph_v> result;
+
+    for(auto && vertex : algr::lazy_bfs(undirected_graph, roots))
+        result.push_back(vertex);
+
+    // then
+    EXPECT_EQ(strategy.entries, result);
+}
+
+TEST_F(SearchingRangesTest, lazyBfs_WhenStoppedAtDepth_ThenVerticesWithinDepth)
+{
+    // given
+    auto range = algr::lazy_bfs(undirected_graph, {undirected_graph[0]});
+    std::vector<ugraph_v> result;
+
+    // when
+    for(auto it = range.begin(); it != range.end() && range.depth() <= 1; ++it)
+        result.push_back(*it);
+
+    // then
+    std::sort(result.begin(), result.end());
+
+    EXPECT_EQ(std::vector<ugraph_v>({undirected_graph[0], undirected_graph[1], undirected_graph[4]}),
+            result);
+    EXPECT_EQ(2, range.depth());
+}
+
+TEST_F(SearchingRangesTest, lazyBfs_WhenResumed_ThenContinuesSearch)
+{
+    // given
+    auto range = algr::lazy_bfs(directed_graph, {directed_graph[1]});
+    std::vector<dgraph_v> result;
+
+    for(auto && vertex : range)
+    {
+        if(result.size() == 2)
+            break;
+
+        result.push_back(vertex);
+    }
+
+    // when
+    for(auto && vertex : range)
+        result.push_back(vertex);
+
+    // then
+    std::sort(result.begin(), result.end());
+
+    EXPECT_EQ(std::vector<dgraph_v>({directed_graph[0], directed_graph[1], directed_graph[3],
+                  directed_graph[4], directed_graph[7]}),
+            result);
+}
+
+TEST_F(SearchingRangesTest, lazyDfs_ThenSameOrderAsDfsRecursive)
+{
+    // given
+    entries_strategy<dgraph_v> strategy;
+    std::vector<dgraph_v> roots = {directed_graph[8], directed_graph[6], directed_graph[1]};
+
+    algr::dfs_recursive(directed_graph, strategy, roots);
+
+    // when
+    std::vector<dgraph_v> result;
+
+    for(auto && vertex : algr::lazy_dfs(directed_graph, roots))
+        result.push_back(vertex);
+
+    // then
+    EXPECT_EQ(strategy.entries, result);
+}
+
+TEST_F(SearchingRangesTest, lazyDfs_WhenTargetFound_ThenDepthOfTarget)
+{
+    // given
+    auto range = algr::lazy_dfs(directed_graph, {directed_graph[5]});
+
+    // when
+    auto it = std::find(range.begin(), range.end(), directed_graph[1]);
+
+    // then
+    ASSERT_TRUE(it != range.end());
+    EXPECT_EQ(3, range.depth());
+}
@@ -2,10 +2,14 @@
  * \file searching_test.cpp
  * \brief Tests: Algorithms for graph searching.
  */
+#include <functional>
+#include <numeric>
 #include <vector>
 #include <gtest/gtest.h>
 #include "algolib/graphs/algorithms/searching.hpp"
+#include "algolib/graphs/dense_graph.hpp"
 #include "algolib/graphs/directed_graph.hpp"
+#include "algolib/graphs/frozen_graph.hpp"
 #include "algolib/graphs/undirected_graph.hpp"
 
 namespace algr = algolib::graphs;
@@ -39,6 +43,23 @@ struct test_strategy : public algr::dfs_strategy<Vertex>
     std::vector<Vertex> exits;
 };
 
+template <typename Vertex>
+struct counting_strategy : public algr::static_strategy<Vertex>
+{
+    void on_entry(const Vertex &)
+    {
+        ++this->entries_count;
+    }
+
+    void on_edge_to_visited(const Vertex &, const Vertex &)
+    {
+        ++this->visited_edges_count;
+    }
+
+    size_t entries_count = 0;
+    size_t visited_edges_count = 0;
+};
+
 class SearchingTest : public testing::Test
 {
 public:
@@ -164,6 +185,51 @@ TEST_F(SearchingTest, bfs_WhenDirectedGraphAndManyRoots_ThenAllVisited)
     EXPECT_EQ(vertices, d_strategy.exits);
 }
 
+TEST_F(SearchingTest, bfs_WhenFrozenDirectedGraphAndSingleRoot_ThenVisitedVertices)
+{
+    // given
+    algr::directed_frozen_graph<> frozen_graph = directed_graph.freeze();
+
+    // when
+    std::vector<dgraph_v> result = algr::bfs(frozen_graph, ed_strategy, {frozen_graph[1]});
+
+    // then
+    std::sort(result.begin(), result.end());
+
+    EXPECT_EQ(std::vector<dgraph_v>({directed_graph[0], directed_graph[1], directed_graph[3],
+                  directed_graph[4], directed_graph[7]}),
+            result);
+}
+
+TEST_F(SearchingTest, bfs_WhenDenseDirectedGraphAndSingleRoot_ThenVisitedVertices)
+{
+    // given
+    algr::dense_directed_graph<> dense_graph(directed_graph.vertices_count());
+
+    for(auto && edge : directed_graph.edges())
+        dense_graph.add_edge(edge);
+
+    // when
+    std::vector<dgraph_v> result = algr::bfs(dense_graph, ed_strategy, {dense_graph[1]});
+
+    // then
+    EXPECT_EQ(std::vector<dgraph_v>({directed_graph[0], directed_graph[1], directed_graph[3],
+                  directed_graph[4], directed_graph[7]}),
+            result);
+}
+
+TEST_F(SearchingTest, bfs_WhenDenseGraphAndRootOutOfRange_ThenInvalidArgument)
+{
+    // given
+    algr::dense_directed_graph<> dense_graph(directed_graph.vertices_count());
+
+    // when
+    auto exec = [&]() { return algr::bfs(dense_graph, ed_strategy, {dgraph_v(17)}); };
+
+    // then
+    EXPECT_THROW(exec(), std::invalid_argument);
+}
+
 #pragma endregion
 #pragma region dfs_iterative
 
@@ -245,6 +311,18 @@ TEST_F(SearchingTest, dfsIterative_WhenDirectedGraphAndManyRoots_ThenAllVisited)
     EXPECT_EQ(vertices, d_strategy.exits);
 }
 
+TEST_F(SearchingTest, dfsIterative_WhenDenseGraphAndRootOutOfRange_ThenInvalidArgument)
+{
+    // given
+    algr::dense_directed_graph<> dense_graph(directed_graph.vertices_count());
+
+    // when
+    auto exec = [&]() { return algr::dfs_iterative(dense_graph, ed_strategy, {dgraph_v(17)}); };
+
+    // then
+    EXPECT_THROW(exec(), std::invalid_argument);
+}
+
 #pragma endregion
 #pragma region dfs_recursive
 
@@ -326,4 +404,114 @@ TEST_F(SearchingTest, dfsRecursive_WhenDirectedGraphAndManyRoots_ThenAllVisited)
     EXPECT_EQ(vertices, d_strategy.exits);
 }
 
+TEST_F(SearchingTest, dfsRecursive_WhenDenseGraphAndRootOutOfRange_ThenInvalidArgument)
+{
+    // given
+    algr::dense_directed_graph<> dense_graph(directed_graph.vertices_count());
+
+    // when
+    auto exec = [&]() { return algr::dfs_recursive(dense_graph, ed_strategy, {dgraph_v(17)}); };
+
+    // then
+    EXPECT_THROW(exec(), std::invalid_argument);
+}
+
+TEST_F(SearchingTest, dfsRecursive_WhenUndirectedGraph_ThenEventsInRecursiveOrder)
+{
+    // given
+    std::vector<ugraph_v> expected_entries, expected_exits;
+    std::vector<bool> visited(undirected_graph.vertices_count());
+    std::function<void(const ugraph_v &)> visit = [&](const ugraph_v & vertex)
+    {
+        visited[vertex.id()] = true;
+        expected_entries.push_back(vertex);
+
+        for(auto && neighbour : undirected_graph.neighbours(vertex))
+            if(!visited[neighbour.id()])
+                visit(neighbour);
+
+        expected_exits.push_back(vertex);
+    };
+
+    visit(undirected_graph[0]);
+
+    // when
+    algr::dfs_recursive(undirected_graph, u_strategy, {undirected_graph[0]});
+
+    // then
+    EXPECT_EQ(expected_entries, u_strategy.entries);
+    EXPECT_EQ(expected_exits, u_strategy.exits);
+}
+
+TEST_F(SearchingTest, dfsRecursive_WhenDeepPathGraph_ThenAllVisitedWithoutStackOverflow)
+{
+    // given
+    size_t vertices_count = 500000;
+    std::vector<size_t> vertex_ids(vertices_count);
+
+    std::iota(vertex_ids.begin(), vertex_ids.end(), 0);
+
+    dgraph_t graph(vertex_ids);
+
+    for(size_t i = 1; i < vertices_count; ++i)
+        graph.add_edge_between(graph[i - 1], graph[i]);
+
+    // when
+    std::vector<dgraph_v> result = algr::dfs_recursive(graph, d_strategy, {graph[0]});
+
+    // then
+    ASSERT_EQ(vertices_count, result.size());
+    ASSERT_EQ(vertices_count, d_strategy.exits.size());
+    EXPECT_EQ(graph[0], d_strategy.entries.front());
+    EXPECT_EQ(graph[vertices_count - 1], d_strategy.entries.back());
+    EXPECT_EQ(graph[vertices_count - 1], d_strategy.exits.front());
+    EXPECT_EQ(graph[0], d_strategy.exits.back());
+}
+
+#pragma endregion
+#pragma region static strategies
+
+TEST_F(SearchingTest, bfs_WhenStaticStrategy_ThenHooksCalled)
+{
+    // given
+    counting_strategy<ugraph_v> strategy;
+
+    // when
+    std::vector<ugraph_v> result = algr::bfs(undirected_graph, strategy, {undirected_graph[0]});
+
+    // then
+    EXPECT_EQ(7, result.size());
+    EXPECT_EQ(7, strategy.entries_count);
+}
+
+TEST_F(SearchingTest, dfsRecursive_WhenStaticStrategy_ThenHooksCalled)
+{
+    // given
+    counting_strategy<dgraph_v> strategy;
+
+    // when
+    std::vector<dgraph_v> result =
+            algr::dfs_recursive(directed_graph, strategy, {directed_graph[1]});
+
+    // then
+    EXPECT_EQ(5, result.size());
+    EXPECT_EQ(5, strategy.entries_count);
+    EXPECT_EQ(1, strategy.visited_edges_count);
+}
+
+TEST_F(SearchingTest, dfsIterative_WhenVirtualStrategyInterface_ThenSameAsConcreteStrategy)
+{
+    // given
+    test_strategy<dgraph_v> strategy;
+    algr::dfs_strategy<dgraph_v> & base_strategy = strategy;
+
+    // when
+    algr::dfs_iterative(directed_graph, base_strategy, {directed_graph[0]});
+    algr::dfs_iterative(directed_graph, d_strategy, {directed_graph[0]});
+
+    // then
+    EXPECT_EQ(d_strategy.entries, strategy.entries);
+    EXPECT_EQ(d_strategy.exits, strategy.exits);
+}
+
 #pragma endregion
@@ -5,11 +5,15 @@
 #include <vector>
 #include <gtest/gtest.h>
 #include "algolib/graphs/algorithms/shortest_paths.hpp"
+#include "algolib/graphs/dense_graph.hpp"
 #include "algolib/graphs/directed_graph.hpp"
+#include "algolib/graphs/frozen_graph.hpp"
 #include "algolib/graphs/properties.hpp"
 #include "algolib/graphs/undirected_graph.hpp"
 
 namespace algr = algolib::graphs;
+namespace alge2 = algolib::geometry::dim2;
+namespace alge3 = algolib::geometry::dim3;
 
 class weighted_impl : public algr::weighted
 {
@@ -29,6 +33,22 @@ private:
     weight_type weight_;
 };
 
+class location_2d : public alge2::point_2d
+{
+public:
+    explicit location_2d(double x = 0.0, double y = 0.0) : point_2d(x, y)
+    {
+    }
+};
+
+class location_3d : public alge3::point_3d
+{
+public:
+    explicit location_3d(double x = 0.0, double y = 0.0, double z = 0.0) : point_3d(x, y, z)
+    {
+    }
+};
+
 class PathsTest : public testing::Test
 {
 public:
@@ -170,6 +190,165 @@ TEST_F(PathsTest, bellmanFord__WhenNegativeCycle_ThenLogicError)
     EXPECT_THROW(exec(), std::logic_error);
 }
 
+TEST_F(PathsTest, bellmanFord__WhenDenseGraphAndSourceOutOfRange__ThenInvalidArgument)
+{
+    // given
+    algr::dense_directed_graph<std::nullptr_t, weighted_impl> dense_graph(10);
+
+    // when
+    auto exec = [&]() { return algr::bellman_ford(dense_graph, dgraph_v(17)); };
+
+    // then
+    EXPECT_THROW(exec(), std::invalid_argument);
+}
+
+#pragma endregion
+#pragma region spfa
+
+TEST_F(PathsTest, spfa__WhenDirectedGraph__ThenSameDistancesAsBellmanFord)
+{
+    // given
+    directed_graph.add_edge_between(directed_graph[2], directed_graph[1], weighted_impl(-2));
+
+    auto expected = algr::bellman_ford(directed_graph, directed_graph[1]);
+
+    // when
+    auto result = algr::spfa(directed_graph, directed_graph[1]);
+
+    // then
+    for(auto && vertex : directed_graph.vertices())
+        EXPECT_EQ(expected.at(vertex), result.distance(vertex));
+
+    EXPECT_EQ(std::vector<dgraph_v>({directed_graph[1], directed_graph[4], directed_graph[5],
+                      directed_graph[8], directed_graph[9]}),
+            result.path(directed_graph[9]));
+    EXPECT_FALSE(result.reached(directed_graph[2]));
+}
+
+TEST_F(PathsTest, spfa__WhenFrozenDirectedGraph__ThenSameAsSimpleGraph)
+{
+    // given
+    directed_graph.add_edge_between(directed_graph[2], directed_graph[1], weighted_impl(-2));
+
+    auto frozen_graph = directed_graph.freeze();
+    auto expected = algr::spfa(directed_graph, directed_graph[2]);
+
+    // when
+    auto result = algr::spfa(frozen_graph, frozen_graph[2]);
+
+    // then
+    for(auto && vertex : directed_graph.vertices())
+    {
+        EXPECT_EQ(expected.distance(vertex), result.distance(vertex));
+        EXPECT_EQ(expected.path(vertex), result.path(vertex));
+    }
+}
+
+TEST_F(PathsTest, spfa__WhenNegativeEdgeShortensPath__ThenShortestPaths)
+{
+    // given
+    directed_graph.add_edge_between(directed_graph[4], directed_graph[6], weighted_impl(-3));
+
+    // when
+    auto result = algr::spfa(directed_graph, directed_graph[1]);
+
+    // then
+    EXPECT_EQ(4.0, result.distance(directed_graph[6]));
+    EXPECT_EQ(8.0, result.distance(directed_graph[5]));
+    EXPECT_EQ(std::make_optional(directed_graph[4]), result.predecessor(directed_graph[6]));
+}
+
+TEST_F(PathsTest, spfa__WhenNegativeCycle__ThenNegativeCycleError)
+{
+    // given
+    directed_graph.add_edge_between(directed_graph[8], directed_graph[3], weighted_impl(-20.0));
+
+    // when
+    std::vector<dgraph_v> cycle;
+
+    try
+    {
+        algr::spfa(directed_graph, directed_graph[1]);
+    }
+    catch(const algr::negative_cycle_error<dgraph_v> & e)
+    {
+        cycle = e.cycle();
+    }
+
+    // then
+    ASSERT_FALSE(cycle.empty());
+
+    double weight = 0.0;
+
+    for(size_t i = 0; i < cycle.size(); ++i)
+    {
+        auto edge = directed_graph[std::make_pair(cycle[i], cycle[(i + 1) % cycle.size()])];
+
+        weight += directed_graph.properties().at(edge).weight();
+    }
+
+    EXPECT_LT(weight, 0.0);
+}
+
+TEST_F(PathsTest, spfa__WhenNegativeCycleAfterLongPath__ThenNegativeCycleError)
+{
+    // given
+    size_t size = 200;
+    algr::directed_simple_graph<int, std::nullptr_t, weighted_impl> graph;
+
+    for(size_t i = 0; i < size; ++i)
+        graph.add_vertex(i);
+
+    for(size_t i = 0; i + 1 < size; ++i)
+        graph.add_edge_between(graph[i], graph[i + 1], weighted_impl(1.0));
+
+    graph.add_edge_between(graph[size - 1], graph[size / 2], weighted_impl(-200.0));
+
+    // when
+    std::vector<algr::vertex<int>> cycle;
+
+    try
+    {
+        algr::spfa(graph, graph[0]);
+    }
+    catch(const algr::negative_cycle_error<algr::vertex<int>> & e)
+    {
+        cycle = e.cycle();
+    }
+
+    // then
+    ASSERT_EQ(size / 2, cycle.size());
+
+    std::sort(cycle.begin(), cycle.end());
+
+    EXPECT_EQ(graph[size / 2], cycle.front());
+    EXPECT_EQ(graph[size - 1], cycle.back());
+}
+
+TEST_F(PathsTest, spfa__WhenNegativeCycle__ThenLogicError)
+{
+    // given
+    directed_graph.add_edge_between(directed_graph[8], directed_graph[3], weighted_impl(-20.0));
+
+    // when
+    auto exec = [&]() { return algr::spfa(directed_graph, directed_graph[1]); };
+
+    // then
+    EXPECT_THROW(exec(), std::logic_error);
+}
+
+TEST_F(PathsTest, spfa__WhenDenseGraphAndSourceOutOfRange__ThenInvalidArgument)
+{
+    // given
+    algr::dense_directed_graph<std::nullptr_t, weighted_impl> dense_graph(10);
+
+    // when
+    auto exec = [&]() { return algr::spfa(dense_graph, dgraph_v(17)); };
+
+    // then
+    EXPECT_THROW(exec(), std::invalid_argument);
+}
+
 #pragma endregion
 #pragma region dijkstra
 
@@ -199,10 +378,76 @@ TEST_F(PathsTest, dijkstra__WhenUndirectedGraph)
     EXPECT_EQ(expected, result);
 }
 
+TEST_F(PathsTest, dijkstra__WhenDenseDirectedGraph)
+{
+    // given
+    algr::dense_directed_graph<std::nullptr_t, weighted_impl> dense_graph(
+            directed_graph.vertices_count());
+
+    for(auto && edge : directed_graph.edges())
+        dense_graph.add_edge(edge, directed_graph.properties().at(edge));
+
+    std::vector<weight_t> distances = {20, 0, inf, 17, 7, 8, 12, 12, 10, 20};
+    auto expected = from_list(distances, dense_graph);
+
+    // when
+    auto result = algr::dijkstra(dense_graph, dense_graph[1]);
+
+    // then
+    EXPECT_EQ(expected, result);
+}
+
+TEST_F(PathsTest, dijkstra__WhenFrozenDirectedGraph)
+{
+    // given
+    auto frozen_graph = directed_graph.freeze();
+    std::vector<weight_t> distances = {20, 0, inf, 17, 7, 8, 12, 12, 10, 20};
+    auto expected = from_list(distances, frozen_graph);
+
+    // when
+    auto result = algr::dijkstra(frozen_graph, frozen_graph[1]);
+
+    // then
+    EXPECT_EQ(expected, result);
+}
+
+TEST_F(PathsTest, dijkstra__WhenFrozenGraphWeightChanged__ThenNewWeightUsed)
+{
+    // given
+    auto frozen_graph = directed_graph.freeze();
+
+    algr::dijkstra(frozen_graph, frozen_graph[1]);
+    frozen_graph.properties()[frozen_graph[std::make_pair(1, 4)]] = weighted_impl(1.0);
+
+    // when
+    auto result = algr::dijkstra(frozen_graph, frozen_graph[1]);
+
+    // then
+    EXPECT_EQ(1.0, result[frozen_graph[4]]);
+    EXPECT_EQ(2.0, result[frozen_graph[5]]);
+}
+
+TEST_F(PathsTest, dijkstra__WhenFrozenGraphWeightWrittenAfterRun__ThenNewWeightUsed)
+{
+    // given
+    auto frozen_graph = directed_graph.freeze();
+    weighted_impl & property = frozen_graph.properties()[frozen_graph[std::make_pair(1, 4)]];
+
+    algr::dijkstra(frozen_graph, frozen_graph[1]);
+    property = weighted_impl(1.0);
+
+    // when
+    auto result = algr::dijkstra(frozen_graph, frozen_graph[1]);
+
+    // then
+    EXPECT_EQ(1.0, result[frozen_graph[4]]);
+    EXPECT_EQ(2.0, result[frozen_graph[5]]);
+}
+
 TEST_F(PathsTest, dijkstra__WhenNegativeEdge__ThenLogicError)
 {
     // given
-    directed_graph.add_edge_between(directed_graph[2], directed_graph[1], weighted_impl(-2));
+    directed_graph.add_edge_between(directed_graph[8], directed_graph[2], weighted_impl(-2));
 
     // when
     auto exec = [&]() { return algr::dijkstra(directed_graph, directed_graph[1]); };
@@ -211,6 +456,338 @@ TEST_F(PathsTest, dijkstra__WhenNegativeEdge__ThenLogicError)
     EXPECT_THROW(exec(), std::logic_error);
 }
 
+TEST_F(PathsTest, dijkstra__WhenNegativeEdgeNotReachable__ThenDistances)
+{
+    // given
+    std::vector<weight_t> distances = {20, 0, inf, 17, 7, 8, 12, 12, 10, 20};
+    auto expected = from_list(distances, directed_graph);
+
+    directed_graph.add_edge_between(directed_graph[2], directed_graph[1], weighted_impl(-2));
+
+    // when
+    auto result = algr::dijkstra(directed_graph, directed_graph[1]);
+
+    // then
+    EXPECT_EQ(expected, result);
+}
+
+TEST_F(PathsTest, dijkstraPaths__WhenDirectedGraph__ThenShortestPaths)
+{
+    // when
+    auto result = algr::dijkstra_paths(directed_graph, directed_graph[1]);
+
+    // then
+    EXPECT_EQ(directed_graph[1], result.source());
+    EXPECT_EQ(20.0, result.distance(directed_graph[9]));
+    EXPECT_EQ(std::vector<dgraph_v>({directed_graph[1], directed_graph[4], directed_graph[5],
+                      directed_graph[8], directed_graph[9]}),
+            result.path(directed_graph[9]));
+    EXPECT_EQ(std::make_optional(directed_graph[3]), result.predecessor(directed_graph[0]));
+    EXPECT_EQ(std::nullopt, result.predecessor(directed_graph[1]));
+}
+
+TEST_F(PathsTest, dijkstraPaths__WhenFrozenUndirectedGraph__ThenShortestPaths)
+{
+    // given
+    auto frozen_graph = undirected_graph.freeze();
+
+    // when
+    auto result = algr::dijkstra_paths(frozen_graph, frozen_graph[1]);
+
+    // then
+    EXPECT_EQ(10.0, result.distance(frozen_graph[8]));
+    EXPECT_EQ(std::vector<ugraph_v>(
+                      {frozen_graph[1], frozen_graph[4], frozen_graph[5], frozen_graph[8]}),
+            result.path(frozen_graph[8]));
+    EXPECT_EQ(std::make_optional(frozen_graph[1]), result.predecessor(frozen_graph[0]));
+    EXPECT_FALSE(result.reached(frozen_graph[9]));
+}
+
+TEST_F(PathsTest, dijkstraPaths__WhenVertexNotReachable__ThenNoPath)
+{
+    // when
+    auto result = algr::dijkstra_paths(undirected_graph, undirected_graph[1]);
+
+    // then
+    EXPECT_FALSE(result.reached(undirected_graph[6]));
+    EXPECT_EQ(inf, result.distance(undirected_graph[6]));
+    EXPECT_EQ(std::vector<ugraph_v>(), result.path(undirected_graph[6]));
+    EXPECT_EQ(std::nullopt, result.predecessor(undirected_graph[6]));
+}
+
+TEST_F(PathsTest, dijkstra__WhenDenseGraphAndSourceOutOfRange__ThenInvalidArgument)
+{
+    // given
+    algr::dense_undirected_graph<std::nullptr_t, weighted_impl> dense_graph(10);
+
+    // when
+    auto exec = [&]() { return algr::dijkstra(dense_graph, ugraph_v(17)); };
+
+    // then
+    EXPECT_THROW(exec(), std::invalid_argument);
+}
+
+TEST_F(PathsTest, dijkstraPaths__WhenDenseGraphAndSourceOutOfRange__ThenInvalidArgument)
+{
+    // given
+    algr::dense_directed_graph<std::nullptr_t, weighted_impl> dense_graph(10);
+
+    // when
+    auto exec = [&]() { return algr::dijkstra_paths(dense_graph, dgraph_v(17)); };
+
+    // then
+    EXPECT_THROW(exec(), std::invalid_argument);
+}
+
+#pragma endregion
+#pragma region shortest_path
+
+TEST_F(PathsTest, shortestPath__WhenDirectedGraph__ThenPathToTarget)
+{
+    // when
+    auto result = algr::shortest_path(directed_graph, directed_graph[1], directed_graph[6]);
+
+    // then
+    EXPECT_EQ(12.0, result.first);
+    EXPECT_EQ(std::vector<dgraph_v>({directed_graph[1], directed_graph[4], directed_graph[5],
+                      directed_graph[6]}),
+            result.second);
+}
+
+TEST_F(PathsTest, shortestPath__WhenTargetNotReachable__ThenNoPath)
+{
+    // when
+    auto result = algr::shortest_path(undirected_graph, undirected_graph[1], undirected_graph[9]);
+
+    // then
+    EXPECT_EQ(inf, result.first);
+    EXPECT_EQ(std::vector<ugraph_v>(), result.second);
+}
+
+TEST_F(PathsTest, bidirectionalDijkstra__WhenDirectedGraph__ThenSameDistancesAsDijkstra)
+{
+    // given
+    auto expected = algr::dijkstra(directed_graph, directed_graph[3]);
+
+    for(auto && target : directed_graph.vertices())
+    {
+        // when
+        auto result = algr::bidirectional_dijkstra(directed_graph, directed_graph[3], target);
+
+        // then
+        ASSERT_EQ(expected[target], result.first);
+
+        if(result.first == inf)
+            continue;
+
+        ASSERT_EQ(directed_graph[3], result.second.front());
+        ASSERT_EQ(target, result.second.back());
+
+        weight_t length = 0.0;
+
+        for(size_t i = 1; i < result.second.size(); ++i)
+            length += directed_graph.properties()
+                              .at(directed_graph[std::make_pair(
+                                      result.second[i - 1], result.second[i])])
+                              .weight();
+
+        EXPECT_EQ(result.first, length);
+    }
+}
+
+TEST_F(PathsTest, bidirectionalDijkstra__WhenFrozenAndDenseGraphs__ThenSameAsDijkstra)
+{
+    // given
+    auto frozen_graph = directed_graph.freeze();
+    algr::dense_directed_graph<std::nullptr_t, weighted_impl> dense_graph(
+            directed_graph.vertices_count());
+
+    for(auto && edge : directed_graph.edges())
+        dense_graph.add_edge(edge, directed_graph.properties().at(edge));
+
+    // property written after freezing is read by the backward search too
+    frozen_graph.properties()[frozen_graph[std::make_pair(5, 8)]] = weighted_impl(1.0);
+
+    auto expected_frozen = algr::dijkstra(frozen_graph, frozen_graph[1]);
+    auto expected_dense = algr::dijkstra(dense_graph, dense_graph[1]);
+
+    for(auto && target : directed_graph.vertices())
+    {
+        // when
+        auto result_frozen = algr::bidirectional_dijkstra(frozen_graph, frozen_graph[1], target);
+        auto result_dense = algr::bidirectional_dijkstra(dense_graph, dense_graph[1], target);
+
+        // then
+        EXPECT_EQ(expected_frozen[target], result_frozen.first);
+        EXPECT_EQ(expected_dense[target], result_dense.first);
+    }
+
+    EXPECT_EQ(9, expected_frozen[frozen_graph[8]]);
+}
+
+TEST_F(PathsTest, bidirectionalDijkstra__WhenUndirectedGraph__ThenPathToTarget)
+{
+    // when
+    auto result =
+            algr::bidirectional_dijkstra(undirected_graph, undirected_graph[0], undirected_graph[8]);
+
+    // then
+    EXPECT_EQ(12.0, result.first);
+    EXPECT_EQ(std::vector<ugraph_v>({undirected_graph[0], undirected_graph[3], undirected_graph[7],
+                      undirected_graph[5], undirected_graph[8]}),
+            result.second);
+}
+
+TEST_F(PathsTest, shortestPath__WhenDenseGraphAndSourceOutOfRange__ThenInvalidArgument)
+{
+    // given
+    algr::dense_directed_graph<std::nullptr_t, weighted_impl> dense_graph(10);
+
+    // when
+    auto exec = [&]() { return algr::shortest_path(dense_graph, dgraph_v(17), dense_graph[1]); };
+
+    // then
+    EXPECT_THROW(exec(), std::invalid_argument);
+}
+
+TEST_F(PathsTest, bidirectionalDijkstra__WhenDenseDirectedSourceOutOfRange__ThenInvalidArgument)
+{
+    // given
+    algr::dense_directed_graph<std::nullptr_t, weighted_impl> dense_graph(10);
+
+    // when
+    auto exec = [&]()
+    {
+        return algr::bidirectional_dijkstra(dense_graph, dgraph_v(17), dense_graph[1]);
+    };
+
+    // then
+    EXPECT_THROW(exec(), std::invalid_argument);
+}
+
+TEST_F(PathsTest, bidirectionalDijkstra__WhenDenseTargetOutOfRange__ThenInvalidArgument)
+{
+    // given
+    algr::dense_undirected_graph<std::nullptr_t, weighted_impl> dense_graph(10);
+
+    // when
+    auto exec = [&]()
+    {
+        return algr::bidirectional_dijkstra(dense_graph, dense_graph[1], ugraph_v(17));
+    };
+
+    // then
+    EXPECT_THROW(exec(), std::invalid_argument);
+}
+
+#pragma endregion
+#pragma region a_star
+
+TEST_F(PathsTest, aStar__WhenZeroHeuristic__ThenSameAsShortestPath)
+{
+    // given
+    auto expected = algr::shortest_path(directed_graph, directed_graph[1], directed_graph[6]);
+
+    // when
+    auto result = algr::a_star(directed_graph, directed_graph[1], directed_graph[6],
+            [](const dgraph_v &, const dgraph_v &) { return 0.0; });
+
+    // then
+    EXPECT_EQ(expected, result);
+}
+
+TEST_F(PathsTest, aStar__WhenEuclideanHeuristic__ThenShortestPath)
+{
+    // given
+    using graph_t = algr::undirected_simple_graph<size_t, location_2d, weighted_impl>;
+
+    size_t size = 6;
+    std::vector<size_t> vertex_ids;
+
+    for(size_t i = 0; i < size * size; ++i)
+        vertex_ids.push_back(i);
+
+    graph_t graph(vertex_ids);
+
+    for(size_t i = 0; i < size; ++i)
+        for(size_t j = 0; j < size; ++j)
+        {
+            graph.properties()[graph[i * size + j]] = location_2d(i, j);
+
+            if(i + 1 < size)
+                graph.add_edge_between(graph[i * size + j], graph[(i + 1) * size + j],
+                        weighted_impl(i % 2 == 0 ? 1.0 : 3.0));
+
+            if(j + 1 < size)
+                graph.add_edge_between(graph[i * size + j], graph[i * size + j + 1],
+                        weighted_impl(j % 3 == 0 ? 1.0 : 2.0));
+        }
+
+    auto expected = algr::dijkstra(graph, graph[0]);
+
+    // when
+    auto result = algr::a_star(
+            graph, graph[0], graph[size * size - 1], algr::euclidean_heuristic(graph));
+
+    // then
+    EXPECT_EQ(expected[graph[size * size - 1]], result.first);
+    EXPECT_EQ(graph[0], result.second.front());
+    EXPECT_EQ(graph[size * size - 1], result.second.back());
+}
+
+TEST_F(PathsTest, aStar__WhenManhattanHeuristic__ThenShortestPath)
+{
+    // given
+    using graph_t = algr::directed_simple_graph<size_t, location_3d, weighted_impl>;
+
+    graph_t graph({0, 1, 2, 3, 4});
+
+    graph.properties()[graph[0]] = location_3d(0.0, 0.0, 0.0);
+    graph.properties()[graph[1]] = location_3d(1.0, 0.0, 0.0);
+    graph.properties()[graph[2]] = location_3d(1.0, 1.0, 0.0);
+    graph.properties()[graph[3]] = location_3d(0.0, 1.0, 1.0);
+    graph.properties()[graph[4]] = location_3d(1.0, 1.0, 1.0);
+    graph.add_edge_between(graph[0], graph[1], weighted_impl(1.0));
+    graph.add_edge_between(graph[1], graph[2], weighted_impl(1.0));
+    graph.add_edge_between(graph[2], graph[4], weighted_impl(4.0));
+    graph.add_edge_between(graph[0], graph[3], weighted_impl(2.0));
+    graph.add_edge_between(graph[3], graph[4], weighted_impl(2.0));
+
+    // when
+    auto result = algr::a_star(graph, graph[0], graph[4], algr::manhattan_heuristic(graph));
+
+    // then
+    EXPECT_EQ(4.0, result.first);
+    EXPECT_EQ(std::vector<graph_t::vertex_type>({graph[0], graph[3], graph[4]}), result.second);
+}
+
+TEST_F(PathsTest, aStar__WhenTargetNotReachable__ThenNoPath)
+{
+    // when
+    auto result = algr::a_star(directed_graph, directed_graph[5], directed_graph[2],
+            [](const dgraph_v &, const dgraph_v &) { return 0.0; });
+
+    // then
+    EXPECT_EQ(inf, result.first);
+    EXPECT_EQ(std::vector<dgraph_v>(), result.second);
+}
+
+TEST_F(PathsTest, aStar__WhenDenseGraphAndSourceOutOfRange__ThenInvalidArgument)
+{
+    // given
+    algr::dense_directed_graph<std::nullptr_t, weighted_impl> dense_graph(10);
+
+    // when
+    auto exec = [&]()
+    {
+        return algr::a_star(dense_graph, dgraph_v(17), dense_graph[1],
+                [](const dgraph_v &, const dgraph_v &) { return 0.0; });
+    };
+
+    // then
+    EXPECT_THROW(exec(), std::invalid_argument);
+}
+
 #pragma endregion
 #pragma region floyd_warshall
 
@@ -257,4 +834,132 @@ TEST_F(PathsTest, floyd_warshall__WhenUndirectedGraph)
     EXPECT_EQ(expected, result);
 }
 
+TEST_F(PathsTest, floydWarshallMatrix__WhenDirectedGraph__ThenShortestDistances)
+{
+    // given
+    std::vector<std::vector<weight_t>> distances = {
+        {0, 4, inf, 21, 11, 12, 16, 16, 14, 24},       {20, 0, inf, 17, 7, 8, 12, 12, 10, 20},
+        {18, -2, 0, 15, 5, 6, 8, 10, 8, 18},           {3, 7, inf, 0, 14, 7, 11, 5, 9, 19},
+        {13, 17, inf, 10, 0, 1, 5, 15, 3, 13},         {inf, inf, inf, inf, inf, 0, 4, inf, 2, 12},
+        {inf, inf, inf, inf, inf, 7, 0, inf, 9, 19},   {inf, inf, inf, inf, inf, 2, 6, 0, 4, 14},
+        {inf, inf, inf, inf, inf, 20, 13, inf, 0, 10}, {inf, inf, inf, inf, inf, 10, 3, inf, 12, 0},
+    };
+
+    directed_graph.add_edge_between(directed_graph[2], directed_graph[1], weighted_impl(-2));
+
+    // when
+    auto result = algr::floyd_warshall_matrix(directed_graph, false, 3);
+
+    // then
+    for(size_t source = 0; source < distances.size(); ++source)
+        for(size_t destination = 0; destination < distances.size(); ++destination)
+            EXPECT_EQ(distances[source][destination],
+                    result.distance(directed_graph[source], directed_graph[destination]));
+
+    EXPECT_FALSE(result.has_paths());
+    EXPECT_THROW(result.path(directed_graph[1], directed_graph[9]), std::logic_error);
+}
+
+TEST_F(PathsTest, floydWarshallMatrix__WhenNegativeEdgesAndManyTiles__ThenSameAsBellmanFord)
+{
+    // given
+    size_t size = 100;
+    algr::directed_simple_graph<int, std::nullptr_t, weighted_impl> graph;
+
+    for(size_t i = 0; i < size; ++i)
+        graph.add_vertex(i);
+
+    // shifting weights by potentials of vertices makes some edges negative, but keeps cycles
+    auto add_edge = [&](size_t source, size_t destination, double weight)
+    {
+        double shift = static_cast<double>(source % 7) - static_cast<double>(destination % 7);
+
+        graph.add_edge_between(graph[source], graph[destination], weighted_impl(weight + shift));
+    };
+
+    for(size_t i = 0; i < size; ++i)
+    {
+        add_edge(i, (i + 1) % size, 1.0);
+        add_edge(i, (i * 11 + 5) % size, i % 4 + 1.0);
+    }
+
+    // when
+    auto result = algr::floyd_warshall_matrix(graph, false, 4);
+
+    // then
+    for(auto && source : graph.vertices())
+    {
+        auto expected = algr::bellman_ford(graph, source);
+
+        for(auto && destination : graph.vertices())
+            EXPECT_EQ(expected.at(destination), result.distance(source, destination));
+    }
+}
+
+TEST_F(PathsTest, floydWarshallMatrix__WhenPaths__ThenShortestPaths)
+{
+    // when
+    auto result = algr::floyd_warshall_matrix(directed_graph, true);
+
+    // then
+    ASSERT_TRUE(result.has_paths());
+    EXPECT_EQ(std::vector<dgraph_v>({directed_graph[1], directed_graph[4], directed_graph[5],
+                      directed_graph[8], directed_graph[9]}),
+            result.path(directed_graph[1], directed_graph[9]));
+    EXPECT_EQ(std::vector<dgraph_v>({directed_graph[3]}),
+            result.path(directed_graph[3], directed_graph[3]));
+    EXPECT_EQ(std::vector<dgraph_v>(), result.path(directed_graph[5], directed_graph[0]));
+}
+
+TEST_F(PathsTest, floydWarshallMatrix__WhenManyTiles__ThenSameDistancesAsDijkstra)
+{
+    // given
+    size_t size = 150;
+    algr::directed_simple_graph<int, std::nullptr_t, weighted_impl> graph;
+
+    for(size_t i = 0; i < size; ++i)
+        graph.add_vertex(i);
+
+    for(size_t i = 0; i < size; ++i)
+    {
+        graph.add_edge_between(graph[i], graph[(i + 1) % size], weighted_impl(1.0));
+        graph.add_edge_between(graph[i], graph[(i * 7 + 3) % size], weighted_impl(i % 5 + 2.0));
+    }
+
+    // when
+    auto result = algr::floyd_warshall_matrix(graph, true, 4);
+
+    // then
+    for(size_t source = 0; source < size; source += 13)
+    {
+        auto expected = algr::dijkstra(graph, graph[source]);
+
+        for(auto && vertex : graph.vertices())
+        {
+            std::vector<algr::vertex<int>> path = result.path(graph[source], vertex);
+            double weight = 0.0;
+
+            for(size_t i = 1; i < path.size(); ++i)
+                weight += graph.properties()
+                                  .at(graph[std::make_pair(path[i - 1], path[i])])
+                                  .weight();
+
+            EXPECT_EQ(expected.at(vertex), result.distance(graph[source], vertex));
+            EXPECT_EQ(expected.at(vertex), weight);
+        }
+    }
+}
+
+TEST_F(PathsTest, floydWarshallMatrix__WhenVertexNotInGraph__ThenOutOfRange)
+{
+    // given
+    auto result = algr::floyd_warshall_matrix(directed_graph);
+
+    // when
+    auto exec = [&]() { return result.distance(directed_graph[0], dgraph_v(17)); };
+
+    // then
+    EXPECT_THROW(exec(), std::out_of_range);
+}
+
 #pragma endregion
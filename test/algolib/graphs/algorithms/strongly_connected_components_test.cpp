@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <gtest/gtest.h>
 #include "algolib/graphs/algorithms/strongly_connected_components.hpp"
+#include "algolib/graphs/frozen_graph.hpp"
 
 namespace algr = algolib::graphs;
 
@@ -83,3 +84,59 @@ TEST(StronglyConnectedComponentsTest, findScc_WhenEmptyGraph_ThenEachVertexIsCom
     for(auto && scc : expected)
         EXPECT_TRUE(std::find(result.begin(), result.end(), scc) != result.end());
 }
+
+TEST(StronglyConnectedComponentsTest, findScc_WhenFrozenGraph_ThenAllListed)
+{
+    // given
+    graph_t graph({0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    graph.add_edge_between(graph[0], graph[4]);
+    graph.add_edge_between(graph[0], graph[5]);
+    graph.add_edge_between(graph[1], graph[0]);
+    graph.add_edge_between(graph[2], graph[3]);
+    graph.add_edge_between(graph[3], graph[1]);
+    graph.add_edge_between(graph[4], graph[1]);
+    graph.add_edge_between(graph[4], graph[3]);
+    graph.add_edge_between(graph[6], graph[5]);
+    graph.add_edge_between(graph[6], graph[9]);
+    graph.add_edge_between(graph[7], graph[4]);
+    graph.add_edge_between(graph[7], graph[6]);
+    graph.add_edge_between(graph[8], graph[3]);
+    graph.add_edge_between(graph[8], graph[7]);
+    graph.add_edge_between(graph[9], graph[8]);
+
+    std::vector<std::unordered_set<graph_v>> expected = {{graph[0], graph[1], graph[3], graph[4]},
+        {graph[2]}, {graph[5]}, {graph[6], graph[7], graph[8], graph[9]}};
+
+    // when
+    std::vector<std::unordered_set<graph_v>> result = algr::find_scc(graph.freeze());
+
+    // then
+    ASSERT_EQ(4, result.size());
+
+    for(auto && scc : expected)
+        EXPECT_TRUE(std::find(result.begin(), result.end(), scc) != result.end());
+}
+
+TEST(StronglyConnectedComponentsTest, findScc_WhenIncomingEdgesIndexed_ThenAllListed)
+{
+    // given
+    graph_t graph({0, 1, 2, 3, 4, 5}, std::pmr::get_default_resource(), true);
+    graph.add_edge_between(graph[0], graph[1]);
+    graph.add_edge_between(graph[1], graph[2]);
+    graph.add_edge_between(graph[2], graph[0]);
+    graph.add_edge_between(graph[2], graph[3]);
+    graph.add_edge_between(graph[3], graph[4]);
+    graph.add_edge_between(graph[4], graph[3]);
+
+    std::vector<std::unordered_set<graph_v>> expected = {
+        {graph[0], graph[1], graph[2]}, {graph[3], graph[4]}, {graph[5]}};
+
+    // when
+    std::vector<std::unordered_set<graph_v>> result = algr::find_scc(graph);
+
+    // then
+    ASSERT_EQ(3, result.size());
+
+    for(auto && scc : expected)
+        EXPECT_TRUE(std::find(result.begin(), result.end(), scc) != result.end());
+}
@@ -0,0 +1,105 @@
+/*!
+ * \file concurrent_graph_test.cpp
+ * \brief Tests: Structure of graph shared by concurrent readers and writers.
+ */
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "algolib/graphs/concurrent_graph.hpp"
+#include "algolib/graphs/directed_graph.hpp"
+
+namespace algr = algolib::graphs;
+
+class ConcurrentGraphTest : public testing::Test
+{
+public:
+    using graph_t = algr::directed_simple_graph<int, std::string, std::string>;
+    using graph_v = graph_t::vertex_type;
+
+    ConcurrentGraphTest() : test_object{graph_t({0, 1, 2})}
+    {
+    }
+
+    ~ConcurrentGraphTest() override = default;
+
+protected:
+    algr::concurrent_graph<graph_t> test_object;
+};
+
+TEST_F(ConcurrentGraphTest, update_ThenNewVersionPublished)
+{
+    // given
+    std::shared_ptr<const graph_t> before = test_object.snapshot();
+
+    // when
+    auto result = test_object.update(
+            [](graph_t & graph)
+            {
+                graph.add_edge_between(graph_v(0), graph_v(1), "zxcvb");
+                return graph.add_edge_between(graph_v(1), graph_v(2));
+            });
+
+    // then
+    EXPECT_EQ(graph_t::edge_type(graph_v(1), graph_v(2)), result);
+    EXPECT_EQ(0, before->edges_count());
+    EXPECT_EQ(2, test_object.read([](const graph_t & graph) { return graph.edges_count(); }));
+    EXPECT_EQ("zxcvb", test_object.read([](const graph_t & graph)
+                               { return graph.properties().at(graph[std::make_pair(0, 1)]); }));
+}
+
+TEST_F(ConcurrentGraphTest, update_WhenException_ThenNothingPublished)
+{
+    // when
+    auto exec = [&]()
+    {
+        test_object.update(
+                [](graph_t & graph)
+                {
+                    graph.add_edge_between(graph_v(0), graph_v(1));
+                    graph.add_edge_between(graph_v(0), graph_v(1));
+                });
+    };
+
+    // then
+    EXPECT_THROW(exec(), std::invalid_argument);
+    EXPECT_EQ(0, test_object.snapshot()->edges_count());
+}
+
+TEST_F(ConcurrentGraphTest, read_WhenConcurrentWriter_ThenConsistentVersions)
+{
+    // given
+    std::vector<std::thread> readers;
+    std::vector<int> consistent(4, 1);
+
+    // when
+    for(size_t i = 0; i < consistent.size(); ++i)
+        readers.emplace_back(
+                [&, i]()
+                {
+                    for(int j = 0; j < 500; ++j)
+                        test_object.read(
+                                [&](const graph_t & graph)
+                                {
+                                    // each update adds a vertex and an edge to it
+                                    if(graph.vertices_count() != graph.edges_count() + 3)
+                                        consistent[i] = 0;
+                                });
+                });
+
+    for(int i = 3; i < 300; ++i)
+        test_object.update(
+                [&](graph_t & graph)
+                {
+                    graph.add_vertex(graph_v(i));
+                    graph.add_edge_between(graph_v(i % 3), graph_v(i));
+                });
+
+    for(auto && reader : readers)
+        reader.join();
+
+    // then
+    EXPECT_EQ(std::vector<int>(consistent.size(), 1), consistent);
+    EXPECT_EQ(297, test_object.snapshot()->edges_count());
+}
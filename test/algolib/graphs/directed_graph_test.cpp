@@ -2,9 +2,14 @@
  * \file directed_graph_test.cpp
  * \brief Tests: Structure of directed graph.
  */
+#include <memory_resource>
+#include <optional>
 #include <string>
+#include <thread>
 #include <gtest/gtest.h>
+#include "algolib/graphs/dense_graph.hpp"
 #include "algolib/graphs/directed_graph.hpp"
+#include "algolib/graphs/frozen_graph.hpp"
 
 namespace algr = algolib::graphs;
 
@@ -259,6 +264,30 @@ TEST_F(DirectedSimpleGraphTest, neighbours_ThenDestinationVerticesOfOutgoingEdge
             result);
 }
 
+TEST_F(DirectedSimpleGraphTest, anyNeighbour_WhenFunctionReturnsTrue_ThenStops)
+{
+    // given
+    test_object.add_edge_between(graph_v(1), graph_v(3));
+    test_object.add_edge_between(graph_v(1), graph_v(4));
+    test_object.add_edge_between(graph_v(1), graph_v(7));
+
+    size_t calls = 0;
+
+    // when
+    bool result = test_object.any_neighbour(graph_v(1),
+            [&](const graph_v & neighbour)
+            {
+                ++calls;
+                return neighbour != graph_v(8);
+            });
+
+    // then
+    EXPECT_TRUE(result);
+    EXPECT_EQ(1, calls);
+    EXPECT_FALSE(test_object.any_neighbour(
+            graph_v(1), [&](const graph_v & neighbour) { return neighbour == graph_v(8); }));
+}
+
 TEST_F(DirectedSimpleGraphTest, outputDegree_ThenNumberOfOutgoingEdges)
 {
     // given
@@ -295,6 +324,134 @@ TEST_F(DirectedSimpleGraphTest, inputDegree_ThenNumberOfIncomingEdges)
     EXPECT_EQ(5, result);
 }
 
+TEST_F(DirectedSimpleGraphTest, incomingEdges_ThenEdgesEndingInVertex)
+{
+    // given
+    test_object.add_edge_between(graph_v(1), graph_v(1));
+    test_object.add_edge_between(graph_v(3), graph_v(1));
+    test_object.add_edge_between(graph_v(4), graph_v(1));
+    test_object.add_edge_between(graph_v(1), graph_v(2));
+    test_object.add_edge_between(graph_v(1), graph_v(6));
+
+    // when
+    std::vector<graph_e> result = test_object.incoming_edges(graph_v(1));
+
+    // then
+    std::sort(result.begin(), result.end());
+
+    EXPECT_EQ(std::vector<graph_e>({graph_e(graph_v(1), graph_v(1)),
+                  graph_e(graph_v(3), graph_v(1)), graph_e(graph_v(4), graph_v(1))}),
+            result);
+}
+
+TEST_F(DirectedSimpleGraphTest, predecessors_WhenNoIncomingEdges_ThenEmpty)
+{
+    // given
+    test_object.add_edge_between(graph_v(1), graph_v(2));
+
+    // when
+    std::vector<graph_v> result = test_object.predecessors(graph_v(1));
+
+    // then
+    EXPECT_EQ(std::vector<graph_v>(), result);
+    EXPECT_EQ(0, test_object.input_degree(graph_v(1)));
+}
+
+TEST_F(DirectedSimpleGraphTest, forEachIncomingEdge_ThenCalledForEdgesEndingInVertex)
+{
+    // given
+    graph_t indexed({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}, std::pmr::get_default_resource(), true);
+
+    for(graph_t * graph : {&test_object, &indexed})
+    {
+        graph->add_edge_between(graph_v(1), graph_v(1));
+        graph->add_edge_between(graph_v(3), graph_v(1));
+        graph->add_edge_between(graph_v(1), graph_v(2));
+        graph->add_edge_between(graph_v(9), graph_v(1));
+    }
+
+    for(graph_t * graph : {&test_object, &indexed})
+    {
+        std::vector<graph_e> result;
+
+        // when
+        graph->for_each_incoming_edge(
+                graph_v(1), [&](const graph_e & edge) { result.push_back(edge); });
+
+        // then
+        std::sort(result.begin(), result.end());
+
+        EXPECT_EQ(std::vector<graph_e>({graph_e(graph_v(1), graph_v(1)),
+                          graph_e(graph_v(3), graph_v(1)), graph_e(graph_v(9), graph_v(1))}),
+                result);
+    }
+}
+
+TEST_F(DirectedSimpleGraphTest, inputDegree_WhenIncomingEdgesIndexed_ThenSameAsScan)
+{
+    // given
+    graph_t indexed({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}, std::pmr::get_default_resource(), true);
+
+    for(graph_t * graph : {&test_object, &indexed})
+    {
+        graph->add_edge_between(graph_v(1), graph_v(1));
+        graph->add_edge_between(graph_v(3), graph_v(1));
+        graph->add_edge_between(graph_v(4), graph_v(1));
+        graph->add_edge_between(graph_v(1), graph_v(2));
+        graph->add_edge_between(graph_v(9), graph_v(2));
+    }
+
+    // when
+    size_t result = indexed.input_degree(graph_v(1));
+
+    // then
+    ASSERT_TRUE(indexed.indexes_incoming());
+    EXPECT_FALSE(test_object.indexes_incoming());
+    EXPECT_EQ(test_object.input_degree(graph_v(1)), result);
+
+    for(graph_v vertex : {graph_v(1), graph_v(2), graph_v(5)})
+    {
+        std::vector<graph_v> expected = test_object.predecessors(vertex);
+        std::vector<graph_v> predecessors = indexed.predecessors(vertex);
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(predecessors.begin(), predecessors.end());
+
+        EXPECT_EQ(expected, predecessors);
+    }
+}
+
+TEST_F(DirectedSimpleGraphTest, reverse_WhenIncomingEdgesIndexed_ThenIndexReversed)
+{
+    // given
+    graph_t indexed({0, 1, 2, 3}, std::pmr::get_default_resource(), true);
+
+    indexed.add_edge_between(graph_v(0), graph_v(1));
+    indexed.add_edge_between(graph_v(0), graph_v(2));
+    indexed.add_edge_between(graph_v(3), graph_v(0));
+
+    // when
+    indexed.reverse();
+
+    // then
+    std::vector<graph_v> result = indexed.predecessors(graph_v(0));
+
+    std::sort(result.begin(), result.end());
+
+    EXPECT_EQ(std::vector<graph_v>({graph_v(1), graph_v(2)}), result);
+    EXPECT_EQ(1, indexed.input_degree(graph_v(3)));
+    EXPECT_TRUE(indexed.reversed_copy().indexes_incoming());
+}
+
+TEST_F(DirectedSimpleGraphTest, predecessors_WhenVertexNotInGraph_ThenInvalidArgument)
+{
+    // when
+    auto exec = [&]() { return test_object.predecessors(graph_v(17)); };
+
+    // then
+    EXPECT_THROW(exec(), std::invalid_argument);
+}
+
 TEST_F(DirectedSimpleGraphTest, addVertex_WhenNewVertex_ThenTrue)
 {
     // given
@@ -404,6 +561,8 @@ TEST_F(DirectedSimpleGraphTest, reverse_ThenAllEdgesHaveReversedDirection)
     EXPECT_EQ("", test_object.properties()[graph_v(9)]);
     EXPECT_EQ(edge_property, test_object.properties()[test_object[std::make_pair(2, 1)]]);
     EXPECT_EQ("", test_object.properties()[test_object[std::make_pair(5, 3)]]);
+    EXPECT_EQ(std::vector<graph_v>({graph_v(2)}), test_object.predecessors(graph_v(1)));
+    EXPECT_EQ(2, test_object.input_degree(graph_v(6)));
 }
 
 TEST_F(DirectedSimpleGraphTest, reversedCopy_ThenNewGraphWithReversedEdges)
@@ -455,3 +614,526 @@ TEST_F(DirectedSimpleGraphTest, reversedCopy_ThenNewGraphWithReversedEdges)
     EXPECT_EQ(edge_property, result.properties()[result[std::make_pair(2, 1)]]);
     EXPECT_EQ("", result.properties()[result[std::make_pair(5, 3)]]);
 }
+
+TEST_F(DirectedSimpleGraphTest, constructor_WhenMemoryResource_ThenAllocatedFromResource)
+{
+    // given
+    struct counting_resource : std::pmr::memory_resource
+    {
+        void * do_allocate(size_t bytes, size_t alignment) override
+        {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void * pointer, size_t bytes, size_t alignment) override
+        {
+            std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource & other) const noexcept override
+        {
+            return this == &other;
+        }
+
+        size_t allocations = 0;
+    } resource;
+
+    // when
+    graph_t result({1, 2, 3}, &resource);
+
+    result.add_edge_between(graph_v(1), graph_v(2), "zxcvb");
+    result.add_edge_between(graph_v(3), graph_v(1));
+    result.reverse();
+
+    // then
+    graph_t result_copy = result;
+
+    EXPECT_EQ(&resource, result.resource());
+    EXPECT_LT(0, resource.allocations);
+    EXPECT_EQ(&resource, result_copy.resource());
+    EXPECT_EQ("zxcvb", result_copy.properties().at(result_copy[std::make_pair(2, 1)]));
+}
+
+TEST_F(DirectedSimpleGraphTest, copyConstructor_WhenOriginalModified_ThenSnapshotUnchanged)
+{
+    // given
+    test_object.add_edge_between(graph_v(1), graph_v(2), "zxcvb");
+    test_object.add_edge_between(graph_v(3), graph_v(1));
+    test_object.properties()[graph_v(1)] = "123456";
+
+    graph_t snapshot = test_object;
+
+    // when
+    test_object.add_vertex(graph_v(10));
+    test_object.add_edge_between(graph_v(1), graph_v(10));
+    test_object.add_edge_between(graph_v(4), graph_v(1));
+    test_object.properties()[test_object[std::make_pair(1, 2)]] = "qwerty";
+    test_object.properties()[graph_v(1)] = "7890";
+
+    // then
+    EXPECT_EQ(10, snapshot.vertices_count());
+    EXPECT_EQ(2, snapshot.edges_count());
+    EXPECT_EQ(1, snapshot.output_degree(graph_v(1)));
+    EXPECT_EQ(1, snapshot.input_degree(graph_v(1)));
+    EXPECT_EQ("zxcvb", snapshot.properties().at(snapshot[std::make_pair(1, 2)]));
+    EXPECT_EQ("123456", snapshot.properties().at(graph_v(1)));
+    EXPECT_EQ(11, test_object.vertices_count());
+    EXPECT_EQ(4, test_object.edges_count());
+    EXPECT_EQ(2, test_object.input_degree(graph_v(1)));
+    EXPECT_EQ("qwerty", test_object.properties().at(test_object[std::make_pair(1, 2)]));
+    EXPECT_EQ("7890", test_object.properties().at(graph_v(1)));
+}
+
+TEST_F(DirectedSimpleGraphTest, copyConstructor_WhenSnapshotReadInOtherThread_ThenStableVersion)
+{
+    // given
+    for(int i = 0; i < 9; ++i)
+        test_object.add_edge_between(graph_v(i), graph_v(i + 1));
+
+    graph_t snapshot = test_object;
+    size_t result = 0;
+
+    // when
+    std::thread reader(
+            [&]()
+            {
+                for(int i = 0; i < 1000; ++i)
+                    for(auto && vertex : snapshot.vertices())
+                        result += snapshot.output_degree(vertex);
+            });
+
+    for(int i = 10; i < 1000; ++i)
+    {
+        test_object.add_vertex(graph_v(i));
+        test_object.add_edge_between(graph_v(i - 1), graph_v(i));
+    }
+
+    reader.join();
+
+    // then
+    EXPECT_EQ(9000, result);
+    EXPECT_EQ(999, test_object.edges_count());
+}
+
+TEST_F(DirectedSimpleGraphTest, copyConstructor_WhenPropertyWrittenLater_ThenSnapshotUnchanged)
+{
+    // given
+    test_object.add_edge_between(graph_v(1), graph_v(2), "zxcvb");
+
+    std::string & vertex_property = test_object.properties()[test_object[1]];
+    std::string & edge_property = test_object.properties()[test_object[std::make_pair(1, 2)]];
+
+    vertex_property = "123456";
+
+    graph_t snapshot = test_object;
+
+    // when
+    vertex_property = "7890";
+    edge_property = "qwerty";
+
+    // then
+    EXPECT_EQ("123456", snapshot.properties().at(graph_v(1)));
+    EXPECT_EQ("zxcvb", snapshot.properties().at(snapshot[std::make_pair(1, 2)]));
+    EXPECT_EQ("7890", test_object.properties().at(graph_v(1)));
+    EXPECT_EQ("qwerty", test_object.properties().at(test_object[std::make_pair(1, 2)]));
+}
+
+TEST_F(DirectedSimpleGraphTest, copyConstructor_WhenPropertyExposed_ThenAdjacencyShared)
+{
+    // given
+    test_object.add_edge_between(graph_v(1), graph_v(2), "zxcvb");
+    test_object.properties()[test_object[std::make_pair(1, 2)]] = "qwerty";
+
+    // when
+    graph_t snapshot = test_object;
+
+    // then
+    EXPECT_EQ(&test_object[std::make_pair(1, 2)], &snapshot[std::make_pair(1, 2)]);
+    EXPECT_EQ("qwerty", snapshot.properties().at(snapshot[std::make_pair(1, 2)]));
+}
+
+TEST_F(DirectedSimpleGraphTest, operatorBrackets_WhenSnapshotDestroyed_ThenVertexReferenceValid)
+{
+    // given
+    std::optional<graph_t> snapshot = std::make_optional(test_object);
+    const graph_v & result = test_object[1];
+
+    // when
+    test_object.add_edge_between(graph_v(1), graph_v(2));
+    snapshot.reset();
+
+    // then
+    EXPECT_EQ(1, result.id());
+    EXPECT_EQ(&result, &test_object[1]);
+}
+
+TEST_F(DirectedSimpleGraphTest, moveConstructor_ThenMovedFromGraphEmpty)
+{
+    // given
+    test_object.add_edge_between(graph_v(1), graph_v(2), "zxcvb");
+
+    // when
+    graph_t result = std::move(test_object);
+
+    // then
+    EXPECT_EQ(10, result.vertices_count());
+    EXPECT_EQ("zxcvb", result.properties().at(result[std::make_pair(1, 2)]));
+    EXPECT_EQ(0, test_object.vertices_count());
+    EXPECT_EQ(0, test_object.edges_count());
+
+    test_object.add_vertex(graph_v(3));
+
+    EXPECT_EQ(1, test_object.vertices_count());
+}
+
+class DirectedFrozenGraphTest : public testing::Test
+{
+public:
+    using graph_t = algr::directed_simple_graph<int, std::string, std::string>;
+    using frozen_t = algr::directed_frozen_graph<int, std::string, std::string>;
+    using graph_v = graph_t::vertex_type;
+    using graph_e = graph_t::edge_type;
+
+protected:
+    graph_t graph;
+
+public:
+    DirectedFrozenGraphTest() : graph{graph_t({0, 1, 2, 3, 4, 5, 6, 7, 8, 9})}
+    {
+        graph.add_edge_between(graph_v(1), graph_v(2), "zxcvb");
+        graph.add_edge_between(graph_v(3), graph_v(5));
+        graph.add_edge_between(graph_v(4), graph_v(9));
+        graph.add_edge_between(graph_v(5), graph_v(4));
+        graph.add_edge_between(graph_v(5), graph_v(7));
+        graph.add_edge_between(graph_v(6), graph_v(2));
+        graph.add_edge_between(graph_v(6), graph_v(6));
+        graph.add_edge_between(graph_v(7), graph_v(8));
+        graph.add_edge_between(graph_v(9), graph_v(1));
+        graph.add_edge_between(graph_v(9), graph_v(6));
+        graph.properties()[graph_v(5)] = "123456";
+    }
+
+    ~DirectedFrozenGraphTest() override = default;
+};
+
+TEST_F(DirectedFrozenGraphTest, freeze_ThenSameVerticesAndEdges)
+{
+    // when
+    frozen_t result = graph.freeze();
+
+    // then
+    std::vector<graph_v> expected_vertices = graph.vertices();
+    std::vector<graph_e> expected_edges = graph.edges();
+    std::vector<graph_e> result_edges = result.edges();
+
+    std::sort(expected_vertices.begin(), expected_vertices.end());
+    std::sort(expected_edges.begin(), expected_edges.end());
+    std::sort(result_edges.begin(), result_edges.end());
+
+    EXPECT_EQ(expected_vertices, result.vertices());
+    EXPECT_EQ(expected_edges, result_edges);
+    EXPECT_EQ(10, result.vertices_count());
+    EXPECT_EQ(10, result.edges_count());
+}
+
+TEST_F(DirectedFrozenGraphTest, operatorBrackets_WhenEdgeInReversedDirection_ThenOutOfRange)
+{
+    // given
+    frozen_t frozen = graph.freeze();
+
+    // when
+    graph_e result = frozen[std::make_pair(5, 7)];
+    auto exec = [&]() { return frozen[std::make_pair(7, 5)]; };
+
+    // then
+    EXPECT_EQ(graph_e(graph_v(5), graph_v(7)), result);
+    EXPECT_THROW(exec(), std::out_of_range);
+}
+
+TEST_F(DirectedFrozenGraphTest, neighbours_ThenDestinationVerticesOfOutgoingEdges)
+{
+    // given
+    frozen_t frozen = graph.freeze();
+
+    // when
+    std::vector<graph_v> result = frozen.neighbours(graph_v(6));
+
+    // then
+    EXPECT_EQ(std::vector<graph_v>({graph_v(2), graph_v(6)}), result);
+    EXPECT_EQ(2, frozen.output_degree(graph_v(6)));
+    EXPECT_EQ(2, frozen.input_degree(graph_v(6)));
+}
+
+TEST_F(DirectedFrozenGraphTest, forEachNeighbour_ThenCalledForDestinationVertices)
+{
+    // given
+    frozen_t frozen = graph.freeze();
+    std::vector<graph_v> result;
+
+    // when
+    frozen.for_each_neighbour(
+            graph_v(5), [&](const graph_v & neighbour) { result.push_back(neighbour); });
+
+    // then
+    EXPECT_EQ(std::vector<graph_v>({graph_v(4), graph_v(7)}), result);
+}
+
+TEST_F(DirectedFrozenGraphTest, anyNeighbour_WhenFunctionReturnsTrue_ThenStops)
+{
+    // given
+    frozen_t frozen = graph.freeze();
+    std::vector<graph_v> result;
+
+    // when
+    bool found = frozen.any_neighbour(graph_v(5),
+            [&](const graph_v & neighbour)
+            {
+                result.push_back(neighbour);
+                return neighbour == graph_v(4);
+            });
+
+    // then
+    EXPECT_TRUE(found);
+    EXPECT_EQ(std::vector<graph_v>({graph_v(4)}), result);
+    EXPECT_FALSE(frozen.any_neighbour(
+            graph_v(5), [&](const graph_v & neighbour) { return neighbour == graph_v(9); }));
+}
+
+TEST_F(DirectedFrozenGraphTest, predecessors_ThenSourceVerticesOfIncomingEdges)
+{
+    // given
+    frozen_t frozen = graph.freeze();
+
+    // when
+    std::vector<graph_v> result = frozen.predecessors(graph_v(2));
+
+    // then
+    EXPECT_EQ(std::vector<graph_v>({graph_v(1), graph_v(6)}), result);
+    EXPECT_EQ(std::vector<graph_e>({graph_e(graph_v(1), graph_v(2)),
+                      graph_e(graph_v(6), graph_v(2))}),
+            frozen.incoming_edges(graph_v(2)));
+}
+
+TEST_F(DirectedFrozenGraphTest, forEachIncomingEdge_ThenCalledForEdgesEndingInVertex)
+{
+    // given
+    frozen_t frozen = graph.freeze();
+    std::vector<graph_e> result;
+
+    // when
+    frozen.for_each_incoming_edge(
+            graph_v(6), [&](const graph_e & edge) { result.push_back(edge); });
+
+    // then
+    EXPECT_EQ(std::vector<graph_e>(
+                      {graph_e(graph_v(6), graph_v(6)), graph_e(graph_v(9), graph_v(6))}),
+            result);
+}
+
+TEST_F(DirectedFrozenGraphTest, properties_ThenPropertiesFromGraph)
+{
+    // given
+    frozen_t frozen = graph.freeze();
+
+    // when
+    auto exec_vertex = [&]() { return frozen.properties().at(graph_v(9)); };
+    auto exec_edge = [&]() { return frozen.properties().at(frozen[std::make_pair(3, 5)]); };
+
+    frozen.properties()[graph_v(9)] = "qwerty";
+
+    // then
+    EXPECT_EQ("123456", frozen.properties().at(graph_v(5)));
+    EXPECT_EQ("zxcvb", frozen.properties().at(frozen[std::make_pair(1, 2)]));
+    EXPECT_EQ("qwerty", exec_vertex());
+    EXPECT_THROW(exec_edge(), std::out_of_range);
+    EXPECT_THROW(frozen.properties()[graph_e(graph_v(2), graph_v(1))], std::invalid_argument);
+}
+
+TEST_F(DirectedFrozenGraphTest, operatorAssignment_ThenPropertiesOfAssignedGraph)
+{
+    // given
+    frozen_t frozen = graph.freeze();
+    frozen_t copied = graph_t({0, 1}).freeze();
+    frozen_t moved = graph_t({0, 1, 2}).freeze();
+
+    // when
+    copied = frozen;
+    moved = std::move(frozen);
+
+    copied.properties()[graph_v(9)] = "qwerty";
+
+    // then
+    EXPECT_EQ(10, copied.vertices_count());
+    EXPECT_EQ(10, moved.edges_count());
+    EXPECT_EQ("qwerty", copied.properties().at(graph_v(9)));
+    EXPECT_EQ("123456", moved.properties().at(graph_v(5)));
+    EXPECT_EQ("zxcvb", moved.properties().at(moved[std::make_pair(1, 2)]));
+}
+
+TEST_F(DirectedFrozenGraphTest, reverse_ThenAllEdgesHaveReversedDirection)
+{
+    // given
+    frozen_t frozen = graph.freeze();
+
+    // when
+    frozen.reverse();
+
+    // then
+    std::vector<graph_e> result_edges = frozen.edges();
+
+    std::sort(result_edges.begin(), result_edges.end());
+
+    ASSERT_EQ(
+            std::vector<graph_e>({graph_e(graph_v(1), graph_v(9)), graph_e(graph_v(2), graph_v(1)),
+                graph_e(graph_v(2), graph_v(6)), graph_e(graph_v(4), graph_v(5)),
+                graph_e(graph_v(5), graph_v(3)), graph_e(graph_v(6), graph_v(6)),
+                graph_e(graph_v(6), graph_v(9)), graph_e(graph_v(7), graph_v(5)),
+                graph_e(graph_v(8), graph_v(7)), graph_e(graph_v(9), graph_v(4))}),
+            result_edges);
+    EXPECT_EQ("zxcvb", frozen.properties().at(frozen[std::make_pair(2, 1)]));
+    EXPECT_EQ(std::vector<graph_v>({graph_v(6), graph_v(9)}), frozen.neighbours(graph_v(6)));
+    EXPECT_EQ(std::vector<graph_v>({graph_v(2), graph_v(6)}), frozen.predecessors(graph_v(6)));
+}
+
+class DenseDirectedGraphTest : public testing::Test
+{
+public:
+    using graph_t = algr::dense_directed_graph<std::string, std::string>;
+    using graph_v = graph_t::vertex_type;
+    using graph_e = graph_t::edge_type;
+
+protected:
+    graph_t test_object;
+
+public:
+    DenseDirectedGraphTest() : test_object{graph_t(10)}
+    {
+    }
+
+    ~DenseDirectedGraphTest() override = default;
+};
+
+TEST_F(DenseDirectedGraphTest, addVertex_ThenNextIdentifier)
+{
+    // when
+    graph_v result = test_object.add_vertex("qwerty");
+
+    // then
+    EXPECT_EQ(graph_v(10), result);
+    EXPECT_EQ(11, test_object.vertices_count());
+    EXPECT_EQ("qwerty", test_object.properties().at(result));
+    EXPECT_TRUE(test_object.is_dense());
+}
+
+TEST_F(DenseDirectedGraphTest, addEdgeBetween_WhenDuplicatedEdge_ThenInvalidArgument)
+{
+    // given
+    test_object.add_edge_between(graph_v(3), graph_v(7));
+
+    // when
+    graph_e result = test_object.add_edge_between(graph_v(7), graph_v(3));
+    auto exec = [&]() { return test_object.add_edge_between(graph_v(3), graph_v(7)); };
+
+    // then
+    EXPECT_EQ(graph_e(graph_v(7), graph_v(3)), result);
+    EXPECT_THROW(exec(), std::invalid_argument);
+    EXPECT_EQ(2, test_object.edges_count());
+}
+
+TEST_F(DenseDirectedGraphTest, operatorBrackets_WhenEdgeNotExists_ThenOutOfRange)
+{
+    // given
+    test_object.add_edge_between(graph_v(3), graph_v(7));
+
+    // when
+    graph_e result = test_object[std::make_pair(3, 7)];
+    auto exec = [&]() { return test_object[std::make_pair(7, 3)]; };
+
+    // then
+    EXPECT_EQ(graph_e(graph_v(3), graph_v(7)), result);
+    EXPECT_THROW(exec(), std::out_of_range);
+    EXPECT_THROW(test_object[12], std::out_of_range);
+}
+
+TEST_F(DenseDirectedGraphTest, predecessors_ThenSourceVerticesOfIncomingEdges)
+{
+    // given
+    test_object.add_edge_between(graph_v(1), graph_v(2));
+    test_object.add_edge_between(graph_v(6), graph_v(2));
+    test_object.add_edge_between(graph_v(2), graph_v(4));
+
+    // when
+    std::vector<graph_v> result = test_object.predecessors(graph_v(2));
+
+    // then
+    EXPECT_EQ(std::vector<graph_v>({graph_v(1), graph_v(6)}), result);
+    EXPECT_EQ(2, test_object.input_degree(graph_v(2)));
+    EXPECT_EQ(1, test_object.output_degree(graph_v(2)));
+}
+
+TEST_F(DenseDirectedGraphTest, forEachIncomingEdge_ThenCalledForEdgesEndingInVertex)
+{
+    // given
+    test_object.add_edge_between(graph_v(1), graph_v(2));
+    test_object.add_edge_between(graph_v(6), graph_v(2));
+    test_object.add_edge_between(graph_v(2), graph_v(4));
+
+    std::vector<graph_e> result;
+
+    // when
+    test_object.for_each_incoming_edge(
+            graph_v(2), [&](const graph_e & edge) { result.push_back(edge); });
+
+    // then
+    EXPECT_EQ(std::vector<graph_e>(
+                      {graph_e(graph_v(1), graph_v(2)), graph_e(graph_v(6), graph_v(2))}),
+            result);
+}
+
+TEST_F(DenseDirectedGraphTest, operatorAssignment_ThenPropertiesOfAssignedGraph)
+{
+    // given
+    graph_t copied(3), moved(2);
+
+    test_object.add_edge_between(graph_v(1), graph_v(2), "zxcvb");
+    test_object.properties()[graph_v(5)] = "123456";
+
+    // when
+    copied = test_object;
+    moved = std::move(test_object);
+
+    copied.properties()[graph_v(9)] = "qwerty";
+
+    // then
+    EXPECT_EQ(10, copied.vertices_count());
+    EXPECT_EQ(1, moved.edges_count());
+    EXPECT_EQ("qwerty", copied.properties().at(graph_v(9)));
+    EXPECT_EQ("123456", moved.properties().at(graph_v(5)));
+    EXPECT_EQ("zxcvb", moved.properties().at(moved[std::make_pair(1, 2)]));
+}
+
+TEST_F(DenseDirectedGraphTest, reverse_ThenAllEdgesHaveReversedDirection)
+{
+    // given
+    graph_e edge = test_object.add_edge_between(graph_v(1), graph_v(2), "zxcvb");
+    test_object.add_edge_between(graph_v(6), graph_v(2));
+    test_object.add_edge_between(graph_v(6), graph_v(6));
+    test_object.properties()[graph_v(5)] = "123456";
+
+    // when
+    test_object.reverse();
+
+    // then
+    std::vector<graph_e> result_edges = test_object.edges();
+
+    std::sort(result_edges.begin(), result_edges.end());
+
+    ASSERT_EQ(std::vector<graph_e>({graph_e(graph_v(2), graph_v(1)),
+                      graph_e(graph_v(2), graph_v(6)), graph_e(graph_v(6), graph_v(6))}),
+            result_edges);
+    EXPECT_EQ("zxcvb", test_object.properties().at(edge.reversed()));
+    EXPECT_EQ("123456", test_object.properties().at(graph_v(5)));
+    EXPECT_THROW(test_object.properties().at(edge), std::invalid_argument);
+    EXPECT_EQ(std::vector<graph_v>({graph_v(2), graph_v(6)}), test_object.predecessors(graph_v(6)));
+}
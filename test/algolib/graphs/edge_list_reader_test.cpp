@@ -0,0 +1,104 @@
+/*!
+ * \file edge_list_reader_test.cpp
+ * \brief Tests: Streaming reading of graph edges from text edge lists.
+ */
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <gtest/gtest.h>
+#include "algolib/graphs/edge_list_reader.hpp"
+
+namespace algr = algolib::graphs;
+
+class weighted_impl : public algr::weighted
+{
+public:
+    explicit weighted_impl(weight_type weight = 0) : weighted(), weight_{weight}
+    {
+    }
+
+    const weight_type & weight() const override
+    {
+        return weight_;
+    }
+
+private:
+    weight_type weight_;
+};
+
+class EdgeListReaderTest : public testing::Test
+{
+public:
+    using dgraph_t = algr::directed_simple_graph<int, std::nullptr_t, weighted_impl>;
+    using ugraph_t = algr::undirected_simple_graph<long>;
+    using graph_v = dgraph_t::vertex_type;
+    using graph_e = dgraph_t::edge_type;
+
+    EdgeListReaderTest() = default;
+
+    ~EdgeListReaderTest() override = default;
+};
+
+TEST_F(EdgeListReaderTest, readEdgeList_WhenWeightedLines_ThenWeightedEdges)
+{
+    // given
+    std::istringstream input("# comment\n1 2 2.5\n\n2,3,-1\r\n3\t1\n% other comment\n4 4 1e3");
+    algr::graph_builder<dgraph_t> builder;
+
+    // when
+    algr::edge_list_stats result = algr::read_edge_list(input, builder, 4, 1);
+
+    // then
+    dgraph_t graph = builder.build();
+
+    EXPECT_EQ(4, result.edges_count);
+    EXPECT_EQ(input.str().size(), result.bytes_count);
+    EXPECT_LE(0.0, result.edges_per_second());
+    EXPECT_EQ(4, graph.vertices_count());
+    EXPECT_EQ(4, graph.edges_count());
+    EXPECT_EQ(2.5, graph.properties().at(graph[std::make_pair(1, 2)]).weight());
+    EXPECT_EQ(-1.0, graph.properties().at(graph[std::make_pair(2, 3)]).weight());
+    EXPECT_EQ(1000.0, graph.properties().at(graph[std::make_pair(4, 4)]).weight());
+    EXPECT_THROW(graph.properties().at(graph[std::make_pair(3, 1)]), std::out_of_range);
+}
+
+TEST_F(EdgeListReaderTest, readEdgeList_WhenManyChunksAndThreads_ThenAllEdgesInOrder)
+{
+    // given
+    std::ostringstream output;
+
+    for(long i = 0; i < 1000; ++i)
+        output << i << " " << (i + 1) % 1000 << "\n";
+
+    std::istringstream input(output.str());
+    algr::graph_builder<ugraph_t> builder;
+
+    // when
+    algr::edge_list_stats result = algr::read_edge_list(input, builder, 64, 4);
+
+    // then
+    ugraph_t graph = builder.build();
+    std::vector<ugraph_t::vertex_type> neighbours = graph.neighbours(graph[10]);
+
+    std::sort(neighbours.begin(), neighbours.end());
+
+    EXPECT_EQ(1000, result.edges_count);
+    EXPECT_EQ(1000, graph.vertices_count());
+    EXPECT_EQ(1000, graph.edges_count());
+    EXPECT_EQ(std::vector<ugraph_t::vertex_type>(
+                      {ugraph_t::vertex_type(9), ugraph_t::vertex_type(11)}),
+            neighbours);
+}
+
+TEST_F(EdgeListReaderTest, readEdgeList_WhenInvalidLine_ThenInvalidArgument)
+{
+    // given
+    std::istringstream input("1 2\n3 x\n");
+    algr::graph_builder<dgraph_t> builder;
+
+    // when
+    auto exec = [&]() { return algr::read_edge_list(input, builder, 2, 2); };
+
+    // then
+    EXPECT_THROW(exec(), std::invalid_argument);
+}
@@ -0,0 +1,131 @@
+/*!
+ * \file flat_hash_test.cpp
+ * \brief Tests: Flat open-addressing hash tables and hash mixing for graph structures.
+ */
+#include <memory_resource>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include <gtest/gtest.h>
+#include "algolib/graphs/edge.hpp"
+#include "algolib/graphs/flat_hash.hpp"
+
+namespace algr = algolib::graphs;
+
+class FlatHashTest : public testing::Test
+{
+public:
+    using vertex_t = algr::vertex<int>;
+    using edge_t = algr::edge<int>;
+
+    FlatHashTest() = default;
+    ~FlatHashTest() override = default;
+
+protected:
+    internal::flat_hash_map<vertex_t, std::string> test_object;
+};
+
+TEST_F(FlatHashTest, emplace_WhenManyKeys_ThenAllFound)
+{
+    // when
+    for(int i = 0; i < 1000; ++i)
+        test_object.emplace(vertex_t(i), std::to_string(i));
+
+    // then
+    ASSERT_EQ(1000, test_object.size());
+
+    for(int i = 0; i < 1000; ++i)
+        EXPECT_EQ(std::to_string(i), test_object.at(vertex_t(i)));
+
+    EXPECT_EQ(test_object.end(), test_object.find(vertex_t(1000)));
+    EXPECT_THROW(test_object.at(vertex_t(-1)), std::out_of_range);
+}
+
+TEST_F(FlatHashTest, emplace_WhenExistingKey_ThenValueNotChanged)
+{
+    // given
+    test_object.emplace(vertex_t(4), "qwerty");
+
+    // when
+    auto result = test_object.emplace(vertex_t(4), "asdfg");
+
+    // then
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ("qwerty", result.first->second);
+    EXPECT_EQ(1, test_object.size());
+}
+
+TEST_F(FlatHashTest, erase_WhenKeysInSameProbes_ThenRemainingKeysFound)
+{
+    // given
+    for(int i = 0; i < 500; ++i)
+        test_object[vertex_t(i)] = std::to_string(i);
+
+    // when
+    for(int i = 0; i < 500; i += 2)
+        test_object.erase(vertex_t(i));
+
+    // then
+    EXPECT_EQ(250, test_object.size());
+
+    for(int i = 0; i < 500; ++i)
+        if(i % 2 == 0)
+            EXPECT_FALSE(test_object.contains(vertex_t(i)));
+        else
+            EXPECT_EQ(std::to_string(i), test_object.at(vertex_t(i)));
+}
+
+TEST_F(FlatHashTest, iteration_ThenEachEntryVisitedOnce)
+{
+    // given
+    std::unordered_set<int> expected;
+
+    for(int i = 0; i < 100; ++i)
+    {
+        test_object.emplace(vertex_t(3 * i), "x");
+        expected.insert(3 * i);
+    }
+
+    std::unordered_set<int> result;
+
+    // when
+    for(auto && entry : test_object)
+        result.insert(entry.first.id());
+
+    // then
+    EXPECT_EQ(expected, result);
+}
+
+TEST_F(FlatHashTest, copyConstructor_WhenMemoryResource_ThenAllocatedFromResource)
+{
+    // given
+    std::pmr::monotonic_buffer_resource resource;
+    internal::pmr::flat_hash_set<edge_t> set(&resource);
+
+    for(int i = 0; i < 50; ++i)
+        set.insert(edge_t(vertex_t(i), vertex_t(i + 1)));
+
+    // when
+    internal::pmr::flat_hash_set<edge_t> result(set, std::pmr::new_delete_resource());
+
+    // then
+    EXPECT_EQ(&resource, set.get_allocator().resource());
+    EXPECT_EQ(std::pmr::new_delete_resource(), result.get_allocator().resource());
+    EXPECT_EQ(50, result.size());
+
+    for(int i = 0; i < 50; ++i)
+        EXPECT_TRUE(result.contains(edge_t(vertex_t(i), vertex_t(i + 1))));
+}
+
+TEST_F(FlatHashTest, hash_WhenConsecutiveVertices_ThenHighBitsDiffer)
+{
+    // given
+    std::unordered_set<size_t> high_bits;
+
+    // when
+    for(int i = 0; i < 256; ++i)
+        high_bits.insert(std::hash<vertex_t>()(vertex_t(i)) >> 56);
+
+    // then
+    EXPECT_GT(high_bits.size(), 128);
+}
@@ -0,0 +1,124 @@
+/*!
+ * \file graph_builder_test.cpp
+ * \brief Tests: Bulk construction of simple graphs.
+ */
+#include <string>
+#include <tuple>
+#include <gtest/gtest.h>
+#include "algolib/graphs/graph_builder.hpp"
+
+namespace algr = algolib::graphs;
+
+class GraphBuilderTest : public testing::Test
+{
+public:
+    using dgraph_t = algr::directed_simple_graph<int, std::string, std::string>;
+    using ugraph_t = algr::undirected_simple_graph<int, std::string, std::string>;
+    using graph_v = dgraph_t::vertex_type;
+    using graph_e = dgraph_t::edge_type;
+
+    GraphBuilderTest() = default;
+
+    ~GraphBuilderTest() override = default;
+};
+
+TEST_F(GraphBuilderTest, build_WhenDirectedGraph_ThenRepeatedEdgesAddedOnce)
+{
+    // given
+    algr::graph_builder<dgraph_t> builder;
+
+    builder.add_vertex(9)
+            .add_edge(1, 2, "first")
+            .add_edge(2, 1)
+            .add_edge(1, 2, "second")
+            .add_edge(3, 3);
+
+    // when
+    dgraph_t result = builder.build();
+
+    // then
+    std::vector<graph_v> result_vertices = result.vertices();
+    std::vector<graph_e> result_edges = result.edges();
+
+    std::sort(result_vertices.begin(), result_vertices.end());
+    std::sort(result_edges.begin(), result_edges.end());
+
+    EXPECT_EQ(std::vector<graph_v>({graph_v(1), graph_v(2), graph_v(3), graph_v(9)}),
+            result_vertices);
+    EXPECT_EQ(std::vector<graph_e>({graph_e(graph_v(1), graph_v(2)),
+                      graph_e(graph_v(2), graph_v(1)), graph_e(graph_v(3), graph_v(3))}),
+            result_edges);
+    EXPECT_EQ("first", result.properties().at(result[std::make_pair(1, 2)]));
+    EXPECT_EQ(1, result.input_degree(graph_v(1)));
+}
+
+TEST_F(GraphBuilderTest, build_WhenUndirectedGraph_ThenOppositeEdgesAddedOnce)
+{
+    // given
+    std::vector<std::tuple<int, int, std::string>> edges = {
+            {5, 3, "first"}, {3, 5, "second"}, {4, 3, "third"}};
+    algr::graph_builder<ugraph_t> builder(edges.size());
+
+    builder.add_edges(edges.begin(), edges.end());
+
+    // when
+    ugraph_t result = builder.build();
+
+    // then
+    std::vector<graph_e> result_edges = result.edges();
+
+    std::sort(result_edges.begin(), result_edges.end());
+
+    EXPECT_EQ(3, result.vertices_count());
+    EXPECT_EQ(std::vector<graph_e>(
+                      {graph_e(graph_v(4), graph_v(3)), graph_e(graph_v(5), graph_v(3))}),
+            result_edges);
+    EXPECT_EQ("first", result.properties().at(result[std::make_pair(3, 5)]));
+    EXPECT_EQ(2, result.output_degree(graph_v(3)));
+}
+
+TEST_F(GraphBuilderTest, build_WhenUndirectedLoopsAndRepeatedEdges_ThenDegreesOfDistinctEdges)
+{
+    // given
+    algr::graph_builder<ugraph_t> builder;
+
+    builder.add_edge(2, 2, "loop")
+            .add_edge(1, 2)
+            .add_edge(2, 1, "reversed")
+            .add_edge(2, 2)
+            .add_edge(2, 3, "third");
+
+    // when
+    ugraph_t result = builder.build();
+
+    // then
+    EXPECT_EQ(3, result.edges_count());
+    EXPECT_EQ(1, result.output_degree(graph_v(1)));
+    EXPECT_EQ(3, result.output_degree(graph_v(2)));
+    EXPECT_EQ(1, result.output_degree(graph_v(3)));
+    EXPECT_EQ("loop", result.properties().at(result[std::make_pair(2, 2)]));
+    EXPECT_EQ("third", result.properties().at(result[std::make_pair(3, 2)]));
+}
+
+TEST_F(GraphBuilderTest, build_WhenManyEdgesAndThreads_ThenAllDistinctEdges)
+{
+    // given
+    std::vector<std::pair<int, int>> edges;
+
+    for(int i = 0; i < 100000; ++i)
+        edges.emplace_back((i * 7919) % 1000, i % 1000);
+
+    algr::graph_builder<algr::directed_simple_graph<int>> builder(edges.size(), 4);
+
+    builder.add_edges(edges.begin(), edges.end());
+
+    // when
+    algr::directed_simple_graph<int> result = builder.build();
+
+    // then
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    EXPECT_EQ(1000, result.vertices_count());
+    EXPECT_EQ(edges.size(), result.edges_count());
+}
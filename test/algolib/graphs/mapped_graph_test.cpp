@@ -0,0 +1,297 @@
+/*!
+ * \file mapped_graph_test.cpp
+ * \brief Tests: Structure of read-only graph memory-mapped from binary file.
+ */
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "algolib/graphs/mapped_graph.hpp"
+
+namespace algr = algolib::graphs;
+
+class weighted_impl : public algr::weighted
+{
+public:
+    explicit weighted_impl(weight_type weight = 0) : weighted(), weight_{weight}
+    {
+    }
+
+    const weight_type & weight() const override
+    {
+        return weight_;
+    }
+
+private:
+    weight_type weight_;
+};
+
+class MappedGraphTest : public testing::Test
+{
+public:
+    using dgraph_t = algr::directed_simple_graph<int, std::nullptr_t, weighted_impl>;
+    using ugraph_t = algr::undirected_simple_graph<int>;
+    using graph_v = dgraph_t::vertex_type;
+    using graph_e = dgraph_t::edge_type;
+
+    MappedGraphTest() = default;
+    ~MappedGraphTest() override = default;
+
+protected:
+    // Each test writes its own file, so that tests run in parallel do not overwrite each other.
+    void SetUp() override
+    {
+        this->path = testing::TempDir() + "mapped_graph_test_"
+                     + testing::UnitTest::GetInstance()->current_test_info()->name() + ".bin";
+    }
+
+    void TearDown() override
+    {
+        std::remove(this->path.c_str());
+    }
+
+    std::string path;
+};
+
+TEST_F(MappedGraphTest, constructor_WhenDirectedGraphWritten_ThenSameTopology)
+{
+    // given
+    dgraph_t graph({4, 1, 2, 8, 3});
+
+    graph.add_edge_between(graph[1], graph[2], weighted_impl(2.5));
+    graph.add_edge_between(graph[4], graph[2], weighted_impl(-1));
+    graph.add_edge_between(graph[2], graph[8]);
+    graph.add_edge_between(graph[1], graph[8], weighted_impl(7));
+    algr::write_graph(graph, this->path);
+
+    // when
+    algr::directed_mapped_graph<int, std::nullptr_t, weighted_impl> result(this->path);
+
+    // then
+    std::vector<graph_e> result_edges = result.edges();
+    std::vector<graph_v> result_predecessors = result.predecessors(graph_v(2));
+
+    std::sort(result_edges.begin(), result_edges.end());
+    std::sort(result_predecessors.begin(), result_predecessors.end());
+
+    EXPECT_EQ(std::vector<graph_v>(
+                      {graph_v(1), graph_v(2), graph_v(3), graph_v(4), graph_v(8)}),
+            result.vertices());
+    EXPECT_EQ(std::vector<graph_e>({graph_e(graph_v(1), graph_v(2)),
+                      graph_e(graph_v(1), graph_v(8)), graph_e(graph_v(2), graph_v(8)),
+                      graph_e(graph_v(4), graph_v(2))}),
+            result_edges);
+    EXPECT_EQ(std::vector<graph_v>({graph_v(2), graph_v(8)}), result.neighbours(graph_v(1)));
+    EXPECT_EQ(std::vector<graph_v>({graph_v(1), graph_v(4)}), result_predecessors);
+    EXPECT_EQ(2, result.output_degree(graph_v(1)));
+    EXPECT_EQ(0, result.input_degree(graph_v(3)));
+    EXPECT_THROW(result[std::make_pair(2, 1)], std::out_of_range);
+}
+
+TEST_F(MappedGraphTest, properties_WhenWeightedEdges_ThenPropertiesFromWeights)
+{
+    // given
+    dgraph_t graph({1, 2, 3});
+
+    graph.add_edge_between(graph[1], graph[2], weighted_impl(2.5));
+    graph.add_edge_between(graph[2], graph[3]);
+    algr::write_graph(graph, this->path);
+
+    algr::directed_mapped_graph<int, std::nullptr_t, weighted_impl> mapped(this->path);
+
+    // when
+    const algr::directed_mapped_graph<int, std::nullptr_t, weighted_impl> result = mapped;
+
+    // then
+    EXPECT_EQ(2.5, result.weight(result[std::make_pair(1, 2)]));
+    EXPECT_EQ(2.5, result.properties().at(result[std::make_pair(1, 2)]).weight());
+    EXPECT_THROW(result.weight(result[std::make_pair(2, 3)]), std::out_of_range);
+    EXPECT_THROW(result.properties().at(result[std::make_pair(2, 3)]), std::out_of_range);
+}
+
+TEST_F(MappedGraphTest, operatorAssignment_ThenPropertiesOfAssignedGraph)
+{
+    // given
+    using mapped_t = algr::directed_mapped_graph<int, std::nullptr_t, weighted_impl>;
+
+    dgraph_t graph({1, 2, 3});
+
+    graph.add_edge_between(graph[1], graph[2], weighted_impl(2.5));
+    graph.add_edge_between(graph[2], graph[3]);
+    algr::write_graph(graph, this->path);
+
+    mapped_t mapped(this->path), copied(this->path), moved(this->path);
+
+    mapped.properties()[mapped[std::make_pair(2, 3)]] = weighted_impl(4);
+
+    // when
+    copied = mapped;
+    moved = std::move(mapped);
+
+    copied.properties()[copied[std::make_pair(1, 2)]] = weighted_impl(-1);
+
+    // then
+    EXPECT_EQ(-1, copied.properties().at(copied[std::make_pair(1, 2)]).weight());
+    EXPECT_EQ(4, copied.properties().at(copied[std::make_pair(2, 3)]).weight());
+    EXPECT_EQ(2.5, moved.properties().at(moved[std::make_pair(1, 2)]).weight());
+    EXPECT_EQ(4, moved.properties().at(moved[std::make_pair(2, 3)]).weight());
+}
+
+TEST_F(MappedGraphTest, properties_WhenReadInManyThreads_ThenSamePropertiesFromWeights)
+{
+    // given
+    dgraph_t graph({1, 2, 3});
+
+    graph.add_edge_between(graph[1], graph[2], weighted_impl(2.5));
+    graph.add_edge_between(graph[2], graph[3], weighted_impl(-4));
+    algr::write_graph(graph, this->path);
+
+    const algr::directed_mapped_graph<int, std::nullptr_t, weighted_impl> mapped(this->path);
+    std::vector<const weighted_impl *> results(4);
+    std::vector<std::thread> threads;
+
+    // when
+    for(size_t i = 0; i < results.size(); ++i)
+        threads.emplace_back(
+                [&, i]() { results[i] = &mapped.properties().at(mapped[std::make_pair(1, 2)]); });
+
+    for(auto && thread : threads)
+        thread.join();
+
+    // then
+    for(auto && result : results)
+    {
+        EXPECT_EQ(results[0], result);
+        EXPECT_EQ(2.5, result->weight());
+    }
+
+    EXPECT_EQ(-4, mapped.properties().at(mapped[std::make_pair(2, 3)]).weight());
+}
+
+TEST_F(MappedGraphTest, forEachIncomingWeightedEdge_ThenWeightsFromFile)
+{
+    // given
+    dgraph_t graph({1, 2, 3});
+
+    graph.add_edge_between(graph[1], graph[3], weighted_impl(2.5));
+    graph.add_edge_between(graph[2], graph[3], weighted_impl(-4));
+    algr::write_graph(graph, this->path);
+
+    algr::directed_mapped_graph<int, std::nullptr_t, weighted_impl> mapped(this->path);
+    std::vector<std::pair<graph_v, double>> result;
+
+    // when
+    mapped.for_each_incoming_weighted_edge(graph_v(3),
+            [&](const graph_e & edge, double weight)
+            { result.emplace_back(edge.source(), weight); });
+
+    // then
+    std::sort(result.begin(), result.end());
+
+    std::vector<std::pair<graph_v, double>> expected = {
+            std::make_pair(graph_v(1), 2.5), std::make_pair(graph_v(2), -4.0)};
+
+    EXPECT_EQ(expected, result);
+}
+
+TEST_F(MappedGraphTest, forEachIndexedWeightedEdge_ThenIndicesAndWeightsFromFile)
+{
+    // given
+    dgraph_t graph({1, 2, 3});
+
+    graph.add_edge_between(graph[1], graph[3], weighted_impl(2.5));
+    graph.add_edge_between(graph[2], graph[3], weighted_impl(-4));
+    algr::write_graph(graph, this->path);
+
+    algr::directed_mapped_graph<int, std::nullptr_t, weighted_impl> mapped(this->path);
+    std::vector<std::pair<graph_v, double>> outgoing, incoming;
+
+    // when
+    mapped.for_each_indexed_weighted_edge(mapped.index(graph_v(2)),
+            [&](size_t index, const graph_v & neighbour, double weight)
+            {
+                EXPECT_EQ(mapped.index(neighbour), index);
+                outgoing.emplace_back(neighbour, weight);
+            });
+    mapped.for_each_incoming_indexed_weighted_edge(mapped.index(graph_v(3)),
+            [&](size_t index, const graph_v & source, double weight)
+            {
+                EXPECT_EQ(mapped.index(source), index);
+                incoming.emplace_back(source, weight);
+            });
+
+    // then
+    std::sort(incoming.begin(), incoming.end());
+
+    std::vector<std::pair<graph_v, double>> expected_outgoing = {
+            std::make_pair(graph_v(3), -4.0)};
+    std::vector<std::pair<graph_v, double>> expected_incoming = {
+            std::make_pair(graph_v(1), 2.5), std::make_pair(graph_v(2), -4.0)};
+
+    EXPECT_TRUE(mapped.is_indexed());
+    EXPECT_EQ(expected_outgoing, outgoing);
+    EXPECT_EQ(expected_incoming, incoming);
+}
+
+TEST_F(MappedGraphTest, constructor_WhenUndirectedGraphWritten_ThenEdgesInBothRows)
+{
+    // given
+    ugraph_t graph({0, 1, 2});
+
+    graph.add_edge_between(graph[0], graph[1]);
+    graph.add_edge_between(graph[2], graph[1]);
+    algr::write_graph(graph, this->path);
+
+    // when
+    algr::undirected_mapped_graph<int> result(this->path);
+
+    // then
+    EXPECT_EQ(2, result.edges_count());
+    EXPECT_EQ(std::vector<graph_v>({graph_v(0), graph_v(2)}), result.neighbours(graph_v(1)));
+    EXPECT_EQ(graph_e(graph_v(2), graph_v(1)), result[std::make_pair(1, 2)]);
+    EXPECT_EQ(2, result.input_degree(graph_v(1)));
+    EXPECT_THROW(algr::directed_mapped_graph<int>{this->path}, std::runtime_error);
+}
+
+TEST_F(MappedGraphTest, constructor_WhenNotGraphFile_ThenRuntimeError)
+{
+    // given
+    std::ofstream(this->path) << "not a graph file at all, only some text";
+
+    // when
+    auto exec = [&]() { return algr::directed_mapped_graph<int>(this->path); };
+
+    // then
+    EXPECT_THROW(exec(), std::runtime_error);
+}
+
+TEST_F(MappedGraphTest, constructor_WhenOtherByteOrder_ThenRuntimeError)
+{
+    // given
+    dgraph_t graph({1, 2});
+
+    graph.add_edge_between(graph[1], graph[2], weighted_impl(2.5));
+    algr::write_graph(graph, this->path);
+
+    std::fstream file(this->path, std::ios::in | std::ios::out | std::ios::binary);
+    char byte_order[8];
+
+    // byte order marker follows the magic bytes
+    file.seekg(8);
+    file.read(byte_order, sizeof(byte_order));
+    std::reverse(std::begin(byte_order), std::end(byte_order));
+    file.seekp(8);
+    file.write(byte_order, sizeof(byte_order));
+    file.close();
+
+    // when
+    auto exec = [&]()
+    { return algr::directed_mapped_graph<int, std::nullptr_t, weighted_impl>(this->path); };
+
+    // then
+    EXPECT_THROW(exec(), std::runtime_error);
+}
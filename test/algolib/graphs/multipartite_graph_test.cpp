@@ -2,6 +2,7 @@
  * \file multipartite_graph_test.cpp
  * \brief Tests: Structure of multipartite graph.
  */
+#include <memory_resource>
 #include <gtest/gtest.h>
 #include "algolib/graphs/multipartite_graph.hpp"
 
@@ -187,7 +188,8 @@ TEST_F(MultipartiteGraphTest, addVertex_WhenNewVertex_ThenTrue)
 TEST_F(MultipartiteGraphTest, verticesFromGroup_WhenValidGroup_ThenVertices)
 {
     // when
-    std::vector<graph_v> result = test_object.vertices_from_group(2);
+    std::vector<graph_v> result(test_object.vertices_from_group(2).begin(),
+            test_object.vertices_from_group(2).end());
 
     // then
     std::sort(result.begin(), result.end());
@@ -204,6 +206,49 @@ TEST_F(MultipartiteGraphTest, verticesFromGroup_WhenInvalidGroup_ThenOutOfRange)
     EXPECT_THROW(exec(), std::out_of_range);
 }
 
+TEST_F(MultipartiteGraphTest, verticesFromGroup_WhenVertexAdded_ThenAppendedToGroup)
+{
+    // given
+    test_object.add_vertex(1, 17);
+
+    // when
+    const std::pmr::vector<graph_v> & result = test_object.vertices_from_group(1);
+
+    // then
+    EXPECT_EQ(std::pmr::vector<graph_v>({graph_v(3), graph_v(4), graph_v(17)}), result);
+}
+
+TEST_F(MultipartiteGraphTest, verticesFromGroup_WhenMemoryResource_ThenAllocatedFromResource)
+{
+    // given
+    std::pmr::monotonic_buffer_resource resource;
+    std::array<std::vector<graph_vi>, 5> vertex_ids = {
+            std::vector<graph_vi>({0, 1}), std::vector<graph_vi>({2})};
+    graph_t graph(vertex_ids, &resource);
+
+    // when
+    graph_t result = graph;
+
+    // then
+    for(size_t i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(&resource, graph.vertices_from_group(i).get_allocator().resource());
+        EXPECT_EQ(&resource, result.vertices_from_group(i).get_allocator().resource());
+    }
+
+    EXPECT_EQ(graph.vertices_from_group(0), result.vertices_from_group(0));
+}
+
+TEST_F(MultipartiteGraphTest, groupOf_ThenGroupOfVertex)
+{
+    // when
+    size_t result = test_object.group_of(graph_v(7));
+
+    // then
+    EXPECT_EQ(2, result);
+    EXPECT_THROW(test_object.group_of(graph_v(21)), std::out_of_range);
+}
+
 TEST_F(MultipartiteGraphTest, addVertex_WhenExistingVertex_ThenInvalidArgument)
 {
     // given
@@ -205,3 +205,78 @@ TEST_F(TreeGraphTest, addVertex_WhenExistingVertex_ThenInvalidArgument)
     EXPECT_EQ(8, test_object.vertices_count());
     EXPECT_EQ(vertex_property, test_object.properties()[vertex]);
 }
+
+TEST_F(TreeGraphTest, rooted_ThenParentsDepthsAndSubtreeSizes)
+{
+    // when
+    std::shared_ptr<const algr::rooted_tree<graph_vi>> result = test_object.rooted(graph_v(0));
+
+    // then
+    ASSERT_EQ(8, result->size());
+    EXPECT_EQ(result, test_object.rooted(graph_v(0)));
+    EXPECT_EQ(graph_v(0), result->root());
+    EXPECT_EQ(0, result->index(graph_v(0)));
+    EXPECT_EQ(graph_v(1), result->parent(graph_v(5)));
+    EXPECT_EQ(graph_v(0), result->parent(graph_v(2)));
+    EXPECT_EQ(graph_e(graph_v(6), graph_v(2)), result->parent_edge(graph_v(6)));
+    EXPECT_EQ(2, result->depth(graph_v(7)));
+    EXPECT_EQ(3, result->subtree_size(graph_v(2)));
+    EXPECT_EQ(8, result->subtree_size(graph_v(0)));
+    EXPECT_EQ(7, result->post_orders()[0]);
+    EXPECT_TRUE(result->is_ancestor(graph_v(1), graph_v(4)));
+    EXPECT_FALSE(result->is_ancestor(graph_v(2), graph_v(4)));
+    EXPECT_THROW(result->parent_edge(graph_v(0)), std::invalid_argument);
+}
+
+TEST_F(TreeGraphTest, rooted_ThenEulerTourWalksAlongEdges)
+{
+    // when
+    std::shared_ptr<const algr::rooted_tree<graph_vi>> result = test_object.rooted(graph_v(1));
+
+    // then
+    const std::vector<size_t> & tour = result->euler_tour();
+
+    ASSERT_EQ(15, tour.size());
+    EXPECT_EQ(0, tour.front());
+    EXPECT_EQ(0, tour.back());
+
+    for(size_t i = 0; i + 1 < tour.size(); ++i)
+        EXPECT_TRUE(result->parents()[tour[i]] == tour[i + 1]
+                    || result->parents()[tour[i + 1]] == tour[i]);
+
+    for(size_t i = 0; i < result->size(); ++i)
+        EXPECT_EQ(i, tour[result->first_occurrences()[i]]);
+}
+
+TEST_F(TreeGraphTest, rooted_WhenVertexAdded_ThenViewRecomputed)
+{
+    // given
+    std::shared_ptr<const algr::rooted_tree<graph_vi>> before = test_object.rooted(graph_v(0));
+
+    // when
+    test_object.add_vertex(8, graph_v(4));
+
+    std::shared_ptr<const algr::rooted_tree<graph_vi>> result = test_object.rooted(graph_v(0));
+
+    // then
+    EXPECT_NE(before, result);
+    EXPECT_EQ(result, test_object.rooted(graph_v(0)));
+    EXPECT_EQ(8, before->size());
+    EXPECT_EQ(9, result->size());
+    EXPECT_EQ(3, result->depth(graph_v(8)));
+}
+
+TEST_F(TreeGraphTest, version_WhenVertexAdded_ThenChanged)
+{
+    // given
+    size_t before = test_object.version();
+
+    test_object.rooted(graph_v(0));
+    test_object.rooted(graph_v(3));
+
+    // when
+    test_object.add_vertex(8, graph_v(4));
+
+    // then
+    EXPECT_EQ(before, test_object.version() - 1);
+}
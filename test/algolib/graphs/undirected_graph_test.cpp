@@ -3,6 +3,8 @@
  * \brief Tests: Structure of undirected graph.
  */
 #include <gtest/gtest.h>
+#include "algolib/graphs/dense_graph.hpp"
+#include "algolib/graphs/frozen_graph.hpp"
 #include "algolib/graphs/undirected_graph.hpp"
 
 namespace algr = algolib::graphs;
@@ -259,6 +261,49 @@ TEST_F(UndirectedSimpleGraphTest, neighbours_ThenDestinationVerticesOfOutgoingEd
             result);
 }
 
+TEST_F(UndirectedSimpleGraphTest, forEachNeighbour_ThenCalledForAllNeighbours)
+{
+    // given
+    test_object.add_edge_between(graph_v(1), graph_v(1));
+    test_object.add_edge_between(graph_v(1), graph_v(3));
+    test_object.add_edge_between(graph_v(1), graph_v(4));
+    test_object.add_edge_between(graph_v(2), graph_v(1));
+    test_object.add_edge_between(graph_v(6), graph_v(1));
+
+    std::vector<graph_v> result;
+
+    // when
+    test_object.for_each_neighbour(
+            graph_v(1), [&](const graph_v & neighbour) { result.push_back(neighbour); });
+
+    // then
+    std::sort(result.begin(), result.end());
+
+    EXPECT_EQ(std::vector<graph_v>(
+                      {graph_v(1), graph_v(2), graph_v(3), graph_v(4), graph_v(6)}),
+            result);
+}
+
+TEST_F(UndirectedSimpleGraphTest, forEachAdjacentEdge_ThenCalledForAllAdjacentEdges)
+{
+    // given
+    test_object.add_edge_between(graph_v(1), graph_v(3));
+    test_object.add_edge_between(graph_v(2), graph_v(1));
+
+    std::vector<graph_e> result;
+
+    // when
+    test_object.for_each_adjacent_edge(
+            graph_v(1), [&](const graph_e & edge) { result.push_back(edge); });
+
+    // then
+    std::sort(result.begin(), result.end());
+
+    EXPECT_EQ(std::vector<graph_e>(
+                      {graph_e(graph_v(1), graph_v(3)), graph_e(graph_v(2), graph_v(1))}),
+            result);
+}
+
 TEST_F(UndirectedSimpleGraphTest, outputDegree_ThenNumberOfOutgoingEdges)
 {
     // given
@@ -363,6 +408,22 @@ TEST_F(UndirectedSimpleGraphTest, addEdgeBetween_WhenDuplicatedEdge_ThenInvalidA
 
     // then
     EXPECT_THROW(exec(), std::invalid_argument);
+    EXPECT_EQ(1, test_object.edges_count());
+}
+
+TEST_F(UndirectedSimpleGraphTest, addEdgeBetween_WhenReversedEdge_ThenInvalidArgument)
+{
+    // given
+    graph_v source(3), destination(7);
+
+    test_object.add_edge_between(source, destination);
+
+    // when
+    auto exec = [&]() { return test_object.add_edge_between(destination, source); };
+
+    // then
+    EXPECT_THROW(exec(), std::invalid_argument);
+    EXPECT_EQ(std::vector<graph_e>({graph_e(source, destination)}), test_object.edges());
 }
 
 TEST_F(UndirectedSimpleGraphTest, asDirected_ThenDirectedGraph)
@@ -407,3 +468,190 @@ TEST_F(UndirectedSimpleGraphTest, asDirected_ThenDirectedGraph)
     EXPECT_EQ(edge_property, result.properties()[result[std::make_pair(graph_v(5), graph_v(1))]]);
     EXPECT_EQ("", result.properties()[result[std::make_pair(graph_v(8), graph_v(0))]]);
 }
+
+TEST_F(UndirectedSimpleGraphTest, copyConstructor_WhenManyEdgesAddedLater_ThenSnapshotUnchanged)
+{
+    // given
+    graph_t graph;
+
+    for(int i = 0; i < 1000; ++i)
+        graph.add_vertex(graph_v(i));
+
+    for(int i = 0; i < 600; ++i)
+        graph.add_edge_between(graph_v(i), graph_v(i + 1));
+
+    std::vector<graph_e> expected = graph.edges();
+    graph_t snapshot = graph;
+
+    // when
+    for(int i = 600; i < 999; ++i)
+        graph.add_edge_between(graph_v(i), graph_v(i + 1));
+
+    // then
+    EXPECT_EQ(600, snapshot.edges_count());
+    EXPECT_EQ(expected, snapshot.edges());
+    EXPECT_EQ(999, graph.edges_count());
+    EXPECT_EQ(graph_e(graph_v(998), graph_v(999)), graph.edges().back());
+}
+
+TEST_F(UndirectedSimpleGraphTest, moveConstructor_ThenMovedFromGraphEmpty)
+{
+    // given
+    test_object.add_edge_between(graph_v(1), graph_v(2));
+    test_object.add_edge_between(graph_v(3), graph_v(1));
+
+    // when
+    graph_t result = std::move(test_object);
+
+    // then
+    EXPECT_EQ(10, result.vertices_count());
+    EXPECT_EQ(2, result.edges_count());
+    EXPECT_EQ(0, test_object.vertices_count());
+    EXPECT_EQ(0, test_object.edges_count());
+}
+
+TEST_F(UndirectedSimpleGraphTest, moveAssignment_ThenMovedFromGraphUsable)
+{
+    // given
+    graph_t result;
+
+    test_object.add_edge_between(graph_v(1), graph_v(2));
+
+    // when
+    result = std::move(test_object);
+
+    // then
+    EXPECT_EQ(1, result.edges_count());
+    EXPECT_EQ(0, test_object.vertices_count());
+
+    test_object.add_vertex(graph_v(1));
+    test_object.add_vertex(graph_v(2));
+    test_object.add_edge_between(graph_v(1), graph_v(2));
+
+    EXPECT_EQ(1, test_object.edges_count());
+    EXPECT_EQ(1, result.edges_count());
+}
+
+class UndirectedFrozenGraphTest : public testing::Test
+{
+public:
+    using graph_t = algr::undirected_simple_graph<int, std::string, std::string>;
+    using frozen_t = algr::undirected_frozen_graph<int, std::string, std::string>;
+    using graph_v = graph_t::vertex_type;
+    using graph_e = graph_t::edge_type;
+
+protected:
+    graph_t graph;
+
+public:
+    UndirectedFrozenGraphTest() : graph{graph_t({0, 1, 2, 3, 4, 5, 6, 7, 8, 9})}
+    {
+        graph.add_edge_between(graph_v(1), graph_v(1));
+        graph.add_edge_between(graph_v(1), graph_v(3), "zxcvb");
+        graph.add_edge_between(graph_v(1), graph_v(4));
+        graph.add_edge_between(graph_v(1), graph_v(7));
+        graph.add_edge_between(graph_v(1), graph_v(9));
+        graph.add_edge_between(graph_v(2), graph_v(1));
+        graph.add_edge_between(graph_v(6), graph_v(1));
+        graph.add_edge_between(graph_v(6), graph_v(3));
+    }
+
+    ~UndirectedFrozenGraphTest() override = default;
+};
+
+TEST_F(UndirectedFrozenGraphTest, freeze_ThenSameVerticesAndEdges)
+{
+    // when
+    frozen_t result = graph.freeze();
+
+    // then
+    std::vector<graph_e> expected_edges = graph.edges();
+    std::vector<graph_e> result_edges = result.edges();
+
+    std::sort(expected_edges.begin(), expected_edges.end());
+    std::sort(result_edges.begin(), result_edges.end());
+
+    EXPECT_EQ(expected_edges, result_edges);
+    EXPECT_EQ(10, result.vertices_count());
+    EXPECT_EQ(8, result.edges_count());
+}
+
+TEST_F(UndirectedFrozenGraphTest, operatorBrackets_WhenEdgeInReversedDirection_ThenEdge)
+{
+    // given
+    frozen_t frozen = graph.freeze();
+
+    // when
+    graph_e result = frozen[std::make_pair(3, 6)];
+
+    // then
+    EXPECT_EQ(graph_e(graph_v(6), graph_v(3)), result);
+    EXPECT_EQ("zxcvb", frozen.properties().at(frozen[std::make_pair(3, 1)]));
+}
+
+TEST_F(UndirectedFrozenGraphTest, neighbours_ThenAllAdjacentVertices)
+{
+    // given
+    frozen_t frozen = graph.freeze();
+
+    // when
+    std::vector<graph_v> result = frozen.neighbours(graph_v(1));
+
+    // then
+    EXPECT_EQ(std::vector<graph_v>({graph_v(1), graph_v(2), graph_v(3), graph_v(4), graph_v(6),
+                  graph_v(7), graph_v(9)}),
+            result);
+    EXPECT_EQ(7, frozen.output_degree(graph_v(1)));
+    EXPECT_EQ(7, frozen.input_degree(graph_v(1)));
+}
+
+class DenseUndirectedGraphTest : public testing::Test
+{
+public:
+    using graph_t = algr::dense_undirected_graph<std::string, std::string>;
+    using graph_v = graph_t::vertex_type;
+    using graph_e = graph_t::edge_type;
+
+protected:
+    graph_t test_object;
+
+public:
+    DenseUndirectedGraphTest() : test_object{graph_t(10)}
+    {
+    }
+
+    ~DenseUndirectedGraphTest() override = default;
+};
+
+TEST_F(DenseUndirectedGraphTest, addEdgeBetween_WhenReversedEdge_ThenInvalidArgument)
+{
+    // given
+    test_object.add_edge_between(graph_v(3), graph_v(7), "zxcvb");
+
+    // when
+    auto exec = [&]() { return test_object.add_edge_between(graph_v(7), graph_v(3)); };
+
+    // then
+    EXPECT_THROW(exec(), std::invalid_argument);
+    EXPECT_EQ(graph_e(graph_v(3), graph_v(7)), test_object[std::make_pair(7, 3)]);
+    EXPECT_EQ("zxcvb", test_object.properties().at(graph_e(graph_v(3), graph_v(7))));
+}
+
+TEST_F(DenseUndirectedGraphTest, neighbours_ThenAllAdjacentVertices)
+{
+    // given
+    test_object.add_edge_between(graph_v(1), graph_v(1));
+    test_object.add_edge_between(graph_v(1), graph_v(3));
+    test_object.add_edge_between(graph_v(2), graph_v(1));
+
+    // when
+    std::vector<graph_v> result = test_object.neighbours(graph_v(1));
+
+    // then
+    std::sort(result.begin(), result.end());
+
+    EXPECT_EQ(std::vector<graph_v>({graph_v(1), graph_v(2), graph_v(3)}), result);
+    EXPECT_EQ(3, test_object.output_degree(graph_v(1)));
+    EXPECT_EQ(3, test_object.edges_count());
+    EXPECT_EQ(1, test_object.input_degree(graph_v(2)));
+}